@@ -5,8 +5,11 @@ layout(location = 1) in vec2 vertUv;
 
 layout(location = 0) out vec2 uv;
 
-layout(std140) uniform Matrices {
+layout(std140) uniform Model {
     mat4 model;
+};
+
+layout(std140) uniform Camera {
     mat4 viewProjection;
 };
 
@@ -0,0 +1,12 @@
+#version 410 core
+
+layout(location = 0) in vec2 uv;
+
+layout(location = 0) out vec4 fragColor;
+
+uniform sampler2D surface;
+
+// No `discard`, so the depth test can run before shading
+void main() {
+    fragColor = vec4(texture(surface, uv).rgb, 1);
+}
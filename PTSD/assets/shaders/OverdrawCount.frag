@@ -0,0 +1,16 @@
+#version 410 core
+
+layout(location = 0) in vec2 uv;
+
+layout(location = 0) out float fragCount;
+
+uniform sampler2D surface;
+
+// Summed by additive blending, see `Core::OverdrawView`
+void main() {
+    // Same test as Base.frag so the depth buffer matches a normal frame
+    if (texture(surface, uv).a < 0.01)
+        discard;
+
+    fragCount = 1;
+}
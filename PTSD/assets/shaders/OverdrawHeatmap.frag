@@ -0,0 +1,19 @@
+#version 410 core
+
+layout(location = 0) in vec2 uv;
+
+layout(location = 0) out vec4 fragColor;
+
+uniform sampler2D counts;
+
+// Black for untouched pixels, then blue, green, yellow and red at 4 or more
+const vec3 ramp[5] = vec3[](vec3(0, 0, 0), vec3(0, 0, 1), vec3(0, 1, 0),
+                            vec3(1, 1, 0), vec3(1, 0, 0));
+
+void main() {
+    float count = clamp(texture(counts, uv).r, 0, 4);
+    int low = int(floor(count));
+    int high = min(low + 1, 4);
+
+    fragColor = vec4(mix(ramp[low], ramp[high], fract(count)), 1);
+}
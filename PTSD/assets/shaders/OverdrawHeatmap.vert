@@ -0,0 +1,13 @@
+#version 410 core
+
+// Full screen quad, already in clip space
+layout(location = 0) in vec2 vertPosition;
+layout(location = 1) in vec2 vertUv;
+
+layout(location = 0) out vec2 uv;
+
+void main() {
+    gl_Position = vec4(vertPosition, 0, 1);
+
+    uv = vertUv;
+}
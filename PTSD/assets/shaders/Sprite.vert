@@ -0,0 +1,17 @@
+#version 410 core
+
+// Already transformed by the model matrix on the CPU, see `Core::SpriteBatch`
+layout(location = 0) in vec3 vertPosition;
+layout(location = 1) in vec2 vertUv;
+
+layout(location = 0) out vec2 uv;
+
+layout(std140) uniform Camera {
+    mat4 viewProjection;
+};
+
+void main() {
+    gl_Position = viewProjection * vec4(vertPosition, 1);
+
+    uv = vertUv;
+}
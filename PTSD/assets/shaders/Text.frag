@@ -0,0 +1,18 @@
+#version 410 core
+
+layout(location = 0) in vec2 uv;
+
+layout(location = 0) out vec4 fragColor;
+
+uniform sampler2D surface;
+uniform vec4 color;
+
+void main() {
+    // Glyphs are stored white in the atlas, tint them here
+    vec4 texColor = texture(surface, uv) * color;
+
+    if (texColor.a < 0.01)
+        discard;
+
+    fragColor = texColor;
+}
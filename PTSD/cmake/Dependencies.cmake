@@ -1,4 +1,5 @@
 find_package(OpenGL REQUIRED)
+find_package(Threads REQUIRED)
 
 cmake_policy(SET CMP0135 NEW)
 
@@ -137,6 +138,7 @@ endif()
 set(DEPENDENCY_LINK_LIBRARIES
     ${OPENGL_LIBRARY}
     glew_s
+    Threads::Threads
 
     SDL2::SDL2-static
     SDL2_image::SDL2_image-static
@@ -29,9 +29,10 @@ int main(int, char **) {
             break;
         }
 
-        ImGui::Render();
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
         context->Update();
     }
+
+    context.reset();
+    Core::Context::DestroyInstance();
     return 0;
 }
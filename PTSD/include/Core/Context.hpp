@@ -5,6 +5,9 @@
 
 #include "config.hpp"
 
+#include "Core/FrameCapture.hpp"
+#include "Core/FramePacer.hpp"
+
 #include "Util/Time.hpp"
 
 namespace Core {
@@ -23,6 +26,14 @@ public:
     Context &operator=(Context &&) = delete;
 
     static std::shared_ptr<Context> GetInstance();
+    /**
+     * @brief Destroy the context `GetInstance()` made, once no other
+     * reference to it is left.
+     *
+     * Call it before `main()` returns. Left to static destruction, the
+     * context would shut the logger down after spdlog's registry is gone.
+     */
+    static void DestroyInstance();
 
     bool GetExit() const { return m_Exit; }
     unsigned int GetWindowWidth() const { return m_WindowWidth; }
@@ -33,21 +44,46 @@ public:
     void SetWindowHeight(unsigned int height) { m_WindowHeight = height; }
     void SetWindowIcon(const std::string &path);
 
+    /**
+     * @brief Write every following frame into `directory`.
+     *
+     * @see FrameCapture
+     */
+    void StartCapture(const std::string &directory,
+                      FrameCapture::Format format = FrameCapture::Format::PNG);
+    /**
+     * @brief Stop capturing once the queued frames are written.
+     */
+    void StopCapture();
+    bool IsCapturing() const { return m_Capture != nullptr; }
+
+    const FramePacer &GetFramePacer() const { return m_Pacer; }
+
+    /**
+     * @brief Start an ImGui frame, `Update()` draws it over the scene.
+     */
     void Setup();
+    /**
+     * @brief Present the frame, wait for the next one and read input for it.
+     */
     void Update();
 
 private:
     SDL_Window *m_Window;
     SDL_GLContext m_GlContext;
 
+    std::unique_ptr<FrameCapture> m_Capture;
+    FramePacer m_Pacer{FPS_CAP};
+
     static std::shared_ptr<Context> s_Instance;
     bool m_Exit = false;
+    bool m_FirstFrameShown = false;
+    bool m_ImGuiFrame = false;
 
     unsigned int m_WindowWidth = WINDOW_WIDTH;
     unsigned int m_WindowHeight = WINDOW_HEIGHT;
 
-    // Can't access Time::s_Now, so using this variable to track time.
-    Util::ms_t m_BeforeUpdateTime = Util::Time::GetElapsedTimeMs();
+    static constexpr unsigned int PACING_REPORT_FRAMES = 600;
 };
 
 } // namespace Core
@@ -0,0 +1,135 @@
+#ifndef CORE_FRAME_CAPTURE_HPP
+#define CORE_FRAME_CAPTURE_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace Core {
+/**
+ * @class FrameCapture
+ * @brief Records the window into an image sequence without stalling frames.
+ *
+ * Each `Capture()` starts an asynchronous read of the back buffer into one of
+ * a ring of pixel pack buffers and maps the one filled `READBACK_LATENCY`
+ * frames earlier, which the GPU has long finished by then. The mapped pixels
+ * are copied into a queue that a worker thread drains, encoding every frame
+ * either as a numbered PNG or as one more picture of a Y4M stream.
+ *
+ * The queue is bounded. When the encoder falls behind, new frames are
+ * dropped and counted instead of stalling the game.
+ *
+ * @code
+ * FrameCapture capture("capture", FrameCapture::Format::PNG, 1280, 720);
+ * // Every frame, after drawing and before SDL_GL_SwapWindow
+ * capture.Capture();
+ * @endcode
+ */
+class FrameCapture {
+public:
+    enum class Format {
+        /// `frame_000000.png`, `frame_000001.png`, ...
+        PNG,
+        /// A single uncompressed 4:4:4 `capture.y4m`, cheaper to encode.
+        Y4M,
+    };
+
+    struct Stats {
+        /// Frames read back from the GPU.
+        unsigned int captured = 0;
+        /// Frames the worker has encoded and written.
+        unsigned int written = 0;
+        /// Frames thrown away because the queue was full.
+        unsigned int dropped = 0;
+        /// Average main thread time spent in `Capture()`.
+        float averageCaptureMs = 0;
+    };
+
+    /**
+     * @param directory Created if missing.
+     * @param width Width of the window in pixels.
+     * @param height Height of the window in pixels.
+     * @param fps Frame rate written into the Y4M header.
+     */
+    FrameCapture(std::string directory, Format format, unsigned int width,
+                 unsigned int height, unsigned int fps = 60);
+    FrameCapture(const FrameCapture &) = delete;
+    FrameCapture(FrameCapture &&) = delete;
+
+    /**
+     * @brief Read back the frames still in flight, wait for the worker to
+     * write everything queued and log the stats.
+     */
+    ~FrameCapture();
+
+    FrameCapture &operator=(const FrameCapture &) = delete;
+    FrameCapture &operator=(FrameCapture &&) = delete;
+
+    /**
+     * @brief Capture the back buffer. Call once per frame, before swapping.
+     */
+    void Capture();
+
+    Stats GetStats() const;
+
+private:
+    struct Frame {
+        unsigned int index;
+        std::vector<Uint8> pixels;
+    };
+
+    /**
+     * @brief Map pack buffer `slot`, queue its pixels and free the slot.
+     *
+     * Waits for the GPU if the copy into the slot isn't finished yet.
+     */
+    void Collect(size_t slot);
+    void Push(Frame frame);
+
+    void Work();
+    void Encode(Frame &frame);
+    void WritePng(const Frame &frame);
+    void WriteY4m(const Frame &frame);
+
+    static constexpr size_t READBACK_LATENCY = 2;
+    static constexpr size_t RING_SIZE = READBACK_LATENCY + 1;
+    static constexpr size_t MAX_QUEUED_FRAMES = 8;
+
+    std::string m_Directory;
+    Format m_Format;
+    unsigned int m_Width;
+    unsigned int m_Height;
+    unsigned int m_Fps;
+
+    std::array<GLuint, RING_SIZE> m_PackBuffers = {};
+    std::array<GLsync, RING_SIZE> m_Fences = {};
+    std::array<unsigned int, RING_SIZE> m_FrameIndices = {};
+    unsigned int m_NextFrame = 0;
+
+    Uint64 m_CaptureTicks = 0;
+    std::atomic<unsigned int> m_Captured{0};
+    std::atomic<unsigned int> m_Written{0};
+    std::atomic<unsigned int> m_Dropped{0};
+
+    // Shared with the worker, guarded by `m_Mutex`
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::deque<Frame> m_Queue;
+    std::vector<std::vector<Uint8>> m_FreeBuffers;
+    bool m_Stopping = false;
+
+    // Only touched by the worker
+    std::ofstream m_Stream;
+    std::vector<Uint8> m_Planes;
+
+    std::thread m_Worker;
+};
+} // namespace Core
+
+#endif
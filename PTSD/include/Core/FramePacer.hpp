@@ -0,0 +1,114 @@
+#ifndef CORE_FRAME_PACER_HPP
+#define CORE_FRAME_PACER_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+#include <array>
+
+namespace Core {
+/**
+ * @brief How buffer swaps wait for the display.
+ */
+enum class VSyncMode {
+    OFF,
+    ON,
+    /// Wait for the display unless the frame is late, then tear instead of
+    /// waiting a whole extra refresh. Falls back to `ON` where unsupported.
+    ADAPTIVE,
+};
+
+/**
+ * @class FramePacer
+ * @brief Holds frames to a fixed rate against a monotonic deadline.
+ *
+ * `SDL_Delay` alone wakes up anywhere within a millisecond or two of the
+ * request. The pacer sleeps until `SPIN_MS` before the deadline and spins on
+ * the performance counter for the rest. Deadlines advance by one period per
+ * frame instead of being measured from the end of the last frame, so a short
+ * wait after a slow frame doesn't drift the schedule.
+ *
+ * Frame to frame times go into a histogram, giving the median, the 99th
+ * percentile and their difference as jitter. The pacer also measures how
+ * long input latched by `Latch()` takes to reach the screen.
+ *
+ * @code
+ * // Every frame
+ * SDL_GL_SwapWindow(window);
+ * pacer.Presented();
+ * pacer.Wait();
+ * Util::Input::Update(); // as late as possible before the simulation
+ * pacer.Latch();
+ * @endcode
+ */
+class FramePacer {
+public:
+    struct Stats {
+        unsigned int frames = 0;
+        /// Median frame to frame time.
+        float p50Ms = 0;
+        /// 99th percentile frame to frame time.
+        float p99Ms = 0;
+        /// `p99Ms - p50Ms`.
+        float jitterMs = 0;
+        /// Average time from latching input to presenting the frame using it.
+        float averageInputLatencyMs = 0;
+        float maxInputLatencyMs = 0;
+    };
+
+    /**
+     * @param fpsCap Frames per second to hold to, 0 to never wait.
+     */
+    explicit FramePacer(unsigned int fpsCap);
+
+    /**
+     * @brief Set the swap interval of the current GL context.
+     *
+     * @return The mode actually in use.
+     */
+    static VSyncMode SetVSync(VSyncMode mode);
+
+    /**
+     * @brief Mark that input for the coming frame was just read.
+     */
+    void Latch();
+
+    /**
+     * @brief Mark that the frame using the latched input was just swapped.
+     */
+    void Presented();
+
+    /**
+     * @brief Wait for the next frame deadline and record the frame time.
+     */
+    void Wait();
+
+    /**
+     * @brief Stats since construction or the last `ResetStats()`.
+     */
+    Stats GetStats() const;
+    void ResetStats();
+
+private:
+    float ToMs(Uint64 ticks) const;
+
+    static constexpr float BIN_MS = 0.25F;
+    /// Up to 50 ms, slower frames land in the last bin.
+    static constexpr std::size_t BIN_COUNT = 200;
+    static constexpr float SPIN_MS = 2.0F;
+
+    Uint64 m_Frequency;
+    Uint64 m_Period;
+    Uint64 m_Deadline = 0;
+    Uint64 m_LastFrame = 0;
+    Uint64 m_LatchTicks = 0;
+
+    std::array<unsigned int, BIN_COUNT> m_Histogram = {};
+    unsigned int m_Frames = 0;
+
+    double m_InputLatencyMs = 0;
+    float m_MaxInputLatencyMs = 0;
+    unsigned int m_InputSamples = 0;
+};
+} // namespace Core
+
+#endif
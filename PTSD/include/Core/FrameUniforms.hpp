@@ -0,0 +1,65 @@
+#ifndef CORE_FRAME_UNIFORMS_HPP
+#define CORE_FRAME_UNIFORMS_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+#include "Core/Drawable.hpp"
+#include "Core/Program.hpp"
+#include "Core/UniformBuffer.hpp"
+#include "Core/UniformRing.hpp"
+
+namespace Core {
+/**
+ * @class FrameUniforms
+ * @brief Owner of the uniform blocks shared by every built-in drawable.
+ *
+ * Shaders declare two blocks instead of one `Matrices` block:
+ *
+ * @code{.glsl}
+ * layout(std140) uniform Model { mat4 model; };
+ * layout(std140) uniform Camera { mat4 viewProjection; };
+ * @endcode
+ *
+ * `Camera` lives in one buffer that is only written when the view-projection
+ * changes. `Model` is streamed through a `UniformRing` so a draw costs one
+ * small copy and a `glBindBufferRange()`.
+ *
+ * Programs that are only positioned by the camera, like the one behind
+ * `SpriteBatch`, may leave the `Model` block out.
+ */
+class FrameUniforms {
+public:
+    static constexpr GLuint MODEL_BINDING = 0;
+    static constexpr GLuint CAMERA_BINDING = 1;
+
+    /**
+     * @brief Point the `Model` and `Camera` blocks of `program` at the shared
+     * bindings. Call once after creating the program.
+     */
+    static void Attach(const Program &program);
+
+    /**
+     * @brief Make `data` visible to the next draw call.
+     *
+     * Flushes `SpriteBatch` first, so sprites queued before this draw end up
+     * below it.
+     */
+    static void Upload(const Matrices &data);
+
+    /**
+     * @brief Only update the `Camera` block.
+     */
+    static void UploadCamera(const glm::mat4 &viewProjection);
+
+    static void NewFrame();
+
+private:
+    static void Init();
+
+    static std::unique_ptr<UniformRing> s_ModelRing;
+    static std::unique_ptr<UniformBuffer<glm::mat4>> s_CameraBuffer;
+    static glm::mat4 s_ViewProjection;
+};
+} // namespace Core
+
+#endif
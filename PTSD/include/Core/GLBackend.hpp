@@ -0,0 +1,215 @@
+#ifndef CORE_GL_BACKEND_HPP
+#define CORE_GL_BACKEND_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+namespace Core {
+/**
+ * @brief The OpenGL entry points the `Core` wrappers call, see `GLBackend`.
+ *
+ * Names drop the `gl` prefix, `GL().BindBuffer(...)` is `glBindBuffer(...)`.
+ */
+struct GLFunctions {
+    // Bindings
+    void(GLAPIENTRY *ActiveTexture)(GLenum texture);
+    void(GLAPIENTRY *BindTexture)(GLenum target, GLuint texture);
+    void(GLAPIENTRY *BindBuffer)(GLenum target, GLuint buffer);
+    void(GLAPIENTRY *BindBufferBase)(GLenum target, GLuint index,
+                                     GLuint buffer);
+    void(GLAPIENTRY *BindBufferRange)(GLenum target, GLuint index,
+                                      GLuint buffer, GLintptr offset,
+                                      GLsizeiptr size);
+    void(GLAPIENTRY *BindVertexArray)(GLuint array);
+    void(GLAPIENTRY *BindFramebuffer)(GLenum target, GLuint framebuffer);
+    void(GLAPIENTRY *UseProgram)(GLuint program);
+
+    // Fixed function state
+    void(GLAPIENTRY *Enable)(GLenum cap);
+    void(GLAPIENTRY *Disable)(GLenum cap);
+    void(GLAPIENTRY *BlendFunc)(GLenum sfactor, GLenum dfactor);
+    void(GLAPIENTRY *DepthMask)(GLboolean flag);
+    void(GLAPIENTRY *PixelStorei)(GLenum pname, GLint param);
+    void(GLAPIENTRY *TexParameteri)(GLenum target, GLenum pname, GLint param);
+
+    // Uploads
+    void(GLAPIENTRY *TexImage2D)(GLenum target, GLint level,
+                                 GLint internalformat, GLsizei width,
+                                 GLsizei height, GLint border, GLenum format,
+                                 GLenum type, const void *pixels);
+    void(GLAPIENTRY *TexSubImage2D)(GLenum target, GLint level, GLint xoffset,
+                                    GLint yoffset, GLsizei width,
+                                    GLsizei height, GLenum format, GLenum type,
+                                    const void *pixels);
+    void(GLAPIENTRY *GenerateMipmap)(GLenum target);
+    void(GLAPIENTRY *BufferData)(GLenum target, GLsizeiptr size,
+                                 const void *data, GLenum usage);
+    void(GLAPIENTRY *BufferSubData)(GLenum target, GLintptr offset,
+                                    GLsizeiptr size, const void *data);
+    void(GLAPIENTRY *BufferStorage)(GLenum target, GLsizeiptr size,
+                                    const void *data, GLbitfield flags);
+    void *(GLAPIENTRY *MapBufferRange)(GLenum target, GLintptr offset,
+                                       GLsizeiptr length, GLbitfield access);
+    GLboolean(GLAPIENTRY *UnmapBuffer)(GLenum target);
+
+    // Uniforms
+    void(GLAPIENTRY *Uniform1i)(GLint location, GLint v0);
+    void(GLAPIENTRY *Uniform1f)(GLint location, GLfloat v0);
+    void(GLAPIENTRY *Uniform2f)(GLint location, GLfloat v0, GLfloat v1);
+    void(GLAPIENTRY *Uniform4f)(GLint location, GLfloat v0, GLfloat v1,
+                                GLfloat v2, GLfloat v3);
+    void(GLAPIENTRY *UniformBlockBinding)(GLuint program,
+                                          GLuint uniformBlockIndex,
+                                          GLuint uniformBlockBinding);
+
+    // Draws
+    void(GLAPIENTRY *DrawElements)(GLenum mode, GLsizei count, GLenum type,
+                                   const void *indices);
+    void(GLAPIENTRY *DrawElementsInstanced)(GLenum mode, GLsizei count,
+                                            GLenum type, const void *indices,
+                                            GLsizei instancecount);
+
+    // Objects
+    void(GLAPIENTRY *GenTextures)(GLsizei n, GLuint *textures);
+    void(GLAPIENTRY *DeleteTextures)(GLsizei n, const GLuint *textures);
+    void(GLAPIENTRY *GenBuffers)(GLsizei n, GLuint *buffers);
+    void(GLAPIENTRY *DeleteBuffers)(GLsizei n, const GLuint *buffers);
+    void(GLAPIENTRY *GenVertexArrays)(GLsizei n, GLuint *arrays);
+    void(GLAPIENTRY *DeleteVertexArrays)(GLsizei n, const GLuint *arrays);
+    void(GLAPIENTRY *EnableVertexAttribArray)(GLuint index);
+    void(GLAPIENTRY *VertexAttribPointer)(GLuint index, GLint size,
+                                          GLenum type, GLboolean normalized,
+                                          GLsizei stride, const void *pointer);
+    void(GLAPIENTRY *VertexAttribDivisor)(GLuint index, GLuint divisor);
+
+    // Shaders and programs
+    GLuint(GLAPIENTRY *CreateShader)(GLenum type);
+    void(GLAPIENTRY *DeleteShader)(GLuint shader);
+    void(GLAPIENTRY *ShaderSource)(GLuint shader, GLsizei count,
+                                   const GLchar *const *string,
+                                   const GLint *length);
+    void(GLAPIENTRY *CompileShader)(GLuint shader);
+    void(GLAPIENTRY *GetShaderiv)(GLuint shader, GLenum pname, GLint *params);
+    void(GLAPIENTRY *GetShaderInfoLog)(GLuint shader, GLsizei bufSize,
+                                       GLsizei *length, GLchar *infoLog);
+    GLuint(GLAPIENTRY *CreateProgram)();
+    void(GLAPIENTRY *DeleteProgram)(GLuint program);
+    void(GLAPIENTRY *AttachShader)(GLuint program, GLuint shader);
+    void(GLAPIENTRY *DetachShader)(GLuint program, GLuint shader);
+    void(GLAPIENTRY *LinkProgram)(GLuint program);
+    void(GLAPIENTRY *ValidateProgram)(GLuint program);
+    void(GLAPIENTRY *ProgramParameteri)(GLuint program, GLenum pname,
+                                        GLint value);
+    void(GLAPIENTRY *ProgramBinary)(GLuint program, GLenum binaryFormat,
+                                    const void *binary, GLsizei length);
+    void(GLAPIENTRY *GetProgramBinary)(GLuint program, GLsizei bufSize,
+                                       GLsizei *length, GLenum *binaryFormat,
+                                       void *binary);
+    void(GLAPIENTRY *GetProgramiv)(GLuint program, GLenum pname,
+                                   GLint *params);
+    void(GLAPIENTRY *GetProgramInfoLog)(GLuint program, GLsizei bufSize,
+                                        GLsizei *length, GLchar *infoLog);
+    GLint(GLAPIENTRY *GetUniformLocation)(GLuint program, const GLchar *name);
+    GLuint(GLAPIENTRY *GetUniformBlockIndex)(GLuint program,
+                                             const GLchar *uniformBlockName);
+
+    // Queries and sync
+    void(GLAPIENTRY *GetIntegerv)(GLenum pname, GLint *data);
+    const GLubyte *(GLAPIENTRY *GetString)(GLenum name);
+    GLsync(GLAPIENTRY *FenceSync)(GLenum condition, GLbitfield flags);
+    void(GLAPIENTRY *DeleteSync)(GLsync sync);
+    GLenum(GLAPIENTRY *ClientWaitSync)(GLsync sync, GLbitfield flags,
+                                       GLuint64 timeout);
+    void(GLAPIENTRY *GenQueries)(GLsizei n, GLuint *ids);
+    void(GLAPIENTRY *DeleteQueries)(GLsizei n, const GLuint *ids);
+    void(GLAPIENTRY *BeginQuery)(GLenum target, GLuint id);
+    void(GLAPIENTRY *EndQuery)(GLenum target);
+    void(GLAPIENTRY *GetQueryObjectuiv)(GLuint id, GLenum pname,
+                                        GLuint *params);
+    void(GLAPIENTRY *GetQueryObjectui64v)(GLuint id, GLenum pname,
+                                          GLuint64 *params);
+};
+
+/**
+ * @brief Where `GL()` sends calls.
+ */
+enum class GLBackendType {
+    /// The driver, through GLEW. Needs a current context.
+    NATIVE,
+    /// Never reaches a driver, calls are counted by kind and otherwise
+    /// ignored. Needs no window or context.
+    NULL_DRIVER,
+};
+
+/**
+ * @class GLBackend
+ * @brief Switches the function table the `Core` wrappers, `Util::Text` and
+ * effect shapes call OpenGL through.
+ *
+ * With `GLBackendType::NULL_DRIVER`, anything that builds images, text or
+ * shader programs and submits them runs without a display, so the CPU side of
+ * rendering can be benchmarked and regression tested on headless machines.
+ * The null driver hands out fresh object names, reports every shader and
+ * program as compiled, linked and valid, fails buffer mapping so callers
+ * take their unmapped path, and has every query result ready at 0.
+ *
+ * `Core::Context` creates the window and still talks to the driver itself,
+ * as do `FrameCapture` and `OverdrawView`, which only exist alongside it.
+ *
+ * @code
+ * // Before creating any Util::Image, Util::Text or Core::Program
+ * Core::GLBackend::Use(Core::GLBackendType::NULL_DRIVER);
+ * renderer.Update();
+ * const auto draws = Core::GLBackend::GetStats().draws;
+ * @endcode
+ */
+class GLBackend {
+public:
+    /**
+     * @brief Calls counted by the null driver since the last `ResetStats()`.
+     *
+     * The native backend counts nothing, see `GLState::Stats` for the state
+     * changes and draws that reach the driver.
+     */
+    struct Stats {
+        unsigned long long calls = 0;
+        /// Object bindings, texture unit switches and `glUseProgram`.
+        unsigned long long binds = 0;
+        /// Texture and buffer data specification.
+        unsigned long long uploads = 0;
+        /// Bytes of pixel or buffer data passed to those uploads.
+        unsigned long long uploadedBytes = 0;
+        /// `glUniform*` calls.
+        unsigned long long uniforms = 0;
+        /// `glDraw*` calls.
+        unsigned long long draws = 0;
+    };
+
+    /**
+     * @brief Route every following call to `type`.
+     *
+     * `NATIVE` reads the entry points GLEW loaded, call it after
+     * `glewInit()`. Objects created under one backend must not be used or
+     * deleted under the other.
+     */
+    static void Use(GLBackendType type);
+    static GLBackendType GetType() { return s_Type; }
+
+    static const GLFunctions &Get() { return *s_Functions; }
+
+    static const Stats &GetStats();
+    static void ResetStats();
+
+private:
+    static GLBackendType s_Type;
+    static const GLFunctions *s_Functions;
+};
+
+/**
+ * @brief The current function table, shorthand for `GLBackend::Get()`.
+ */
+inline const GLFunctions &GL() {
+    return GLBackend::Get();
+}
+} // namespace Core
+
+#endif
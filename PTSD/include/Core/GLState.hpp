@@ -0,0 +1,142 @@
+#ifndef CORE_GL_STATE_HPP
+#define CORE_GL_STATE_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+namespace Core {
+/**
+ * @brief How much driver-side checking is turned on.
+ *
+ * Higher tiers catch more mistakes but cost more per call, so release builds
+ * should stay on `NONE`.
+ */
+enum class ValidationTier {
+    /// No debug output and no program validation.
+    NONE,
+    /// Asynchronous `GL_DEBUG_OUTPUT`, messages may arrive late.
+    DEBUG_OUTPUT,
+    /// Synchronous debug output, the callback runs on the offending call.
+    SYNCHRONOUS,
+    /// Synchronous debug output plus `Program::Validate()` on every draw.
+    FULL,
+};
+
+/**
+ * @class GLState
+ * @brief Shadow copy of the OpenGL state PTSD touches.
+ *
+ * Every wrapper in `Core` binds through this class instead of calling OpenGL
+ * directly. A call is only forwarded to the driver when it would actually
+ * change something, the rest are counted and dropped.
+ *
+ * @note The cache only knows about calls that go through it. Call
+ * `Invalidate()` after handing the context to code that talks to OpenGL on its
+ * own.
+ */
+class GLState {
+public:
+    /**
+     * @brief Per-frame counters of the calls made through this class.
+     *
+     * Only binds and fixed function state go through the cache, uploads,
+     * uniforms and the like are not counted here.
+     */
+    struct Stats {
+        /// State changes forwarded to the driver.
+        unsigned int stateChanges = 0;
+        /// State changes dropped because the state was already set.
+        unsigned int redundantStateChanges = 0;
+        /// `glDraw*` calls.
+        unsigned int draws = 0;
+    };
+
+    static void UseProgram(GLuint program);
+    static void BindVertexArray(GLuint vertexArray);
+    static void BindTexture(GLuint unit, GLuint texture);
+    static void BindUniformBuffer(GLuint buffer);
+    static void BindUniformBufferBase(GLuint binding, GLuint buffer);
+    /**
+     * @brief Always issued, ranges are expected to move every draw.
+     */
+    static void BindUniformBufferRange(GLuint binding, GLuint buffer,
+                                       GLintptr offset, GLsizeiptr size);
+    static void BindFramebuffer(GLuint framebuffer);
+
+    static void SetBlend(bool enabled);
+    static void SetBlendFunc(GLenum src, GLenum dst);
+    static void SetDepthTest(bool enabled);
+    static void SetDepthMask(bool enabled);
+
+    /**
+     * @brief Drop cached entries that refer to a deleted object so a recycled
+     * name is bound again.
+     */
+    static void ForgetProgram(GLuint program);
+    static void ForgetVertexArray(GLuint vertexArray);
+    static void ForgetTexture(GLuint texture);
+    static void ForgetBuffer(GLuint buffer);
+
+    /**
+     * @brief Forget everything, the next call of each kind is always issued.
+     */
+    static void Invalidate();
+
+    static void CountDraw() { s_Current.draws++; }
+
+    /**
+     * @brief Queried once, `Texture::Bind()` used to ask the driver every call.
+     */
+    static GLint GetMaxTextureUnits();
+
+    static ValidationTier GetValidationTier() { return s_Tier; }
+
+    /**
+     * @brief Switch tiers at runtime, toggles `GL_DEBUG_OUTPUT` and
+     * `GL_DEBUG_OUTPUT_SYNCHRONOUS` to match.
+     */
+    static void SetValidationTier(ValidationTier tier);
+
+    static bool ShouldValidatePrograms() {
+        return s_Tier == ValidationTier::FULL;
+    }
+
+    /**
+     * @brief Close the current frame and start counting a new one.
+     */
+    static void NewFrame();
+
+    /**
+     * @brief Counters of the last finished frame.
+     */
+    static const Stats &GetLastFrameStats() { return s_LastFrame; }
+
+private:
+    static constexpr GLuint UNKNOWN = ~0U;
+    static constexpr std::size_t MAX_TRACKED_UNITS = 32;
+    static constexpr std::size_t MAX_TRACKED_UBO_BINDINGS = 16;
+
+    static bool Changed(GLuint &cached, GLuint value);
+
+    static GLuint s_Program;
+    static GLuint s_VertexArray;
+    static GLuint s_ActiveUnit;
+    static std::array<GLuint, MAX_TRACKED_UNITS> s_Textures;
+    static GLuint s_UniformBuffer;
+    static GLuint s_Framebuffer;
+    static std::array<GLuint, MAX_TRACKED_UBO_BINDINGS> s_UniformBindings;
+
+    static GLuint s_Blend;
+    static GLuint s_BlendSrc;
+    static GLuint s_BlendDst;
+    static GLuint s_DepthTest;
+    static GLuint s_DepthMask;
+
+    static GLint s_MaxTextureUnits;
+    static ValidationTier s_Tier;
+
+    static Stats s_Current;
+    static Stats s_LastFrame;
+};
+} // namespace Core
+
+#endif
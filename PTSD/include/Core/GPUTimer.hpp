@@ -0,0 +1,150 @@
+#ifndef CORE_GPU_TIMER_HPP
+#define CORE_GPU_TIMER_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+namespace Core {
+/**
+ * @class GPUTimer
+ * @brief Measures GPU time per render pass with `GL_TIME_ELAPSED` queries.
+ *
+ * Passes are named by the code drawing them, with `GPUTimerScope`. Only one
+ * pass is timed at a time: entering a pass ends the query of the one it
+ * interrupts, and leaving it starts a new query for that one again. A pass
+ * drawn in several pieces during a frame adds up its pieces.
+ *
+ * Queries come from a ring of `FRAMES_IN_FLIGHT` frames. The results of a
+ * frame are read when its slot comes around again, two frames later, by
+ * which time the GPU is done with them on any driver seen so far, llvmpipe
+ * included. A frame whose results still aren't there is skipped rather than
+ * waited for, see `GetStats()`.
+ *
+ * Needs OpenGL 3.3 or `ARB_timer_query`, without it `SetEnabled()` warns
+ * and stays off.
+ *
+ * @code
+ * void EffectManager::Draw() {
+ *     Core::GPUTimerScope timer("Effects");
+ *     // Draw calls from here to the end of the block count as "Effects"
+ * }
+ * @endcode
+ */
+class GPUTimer {
+public:
+    struct Stats {
+        /// Frames read back.
+        unsigned int frames = 0;
+        /// Frames skipped because their results weren't ready.
+        unsigned int late = 0;
+        /// Pieces of passes left untimed because a frame ran out of queries.
+        unsigned int dropped = 0;
+    };
+
+    /// Passes past this many are timed as the last one.
+    static constexpr std::size_t MAX_PASSES = 16;
+    /// Queries each frame, a pass interrupted by another takes one more.
+    static constexpr std::size_t MAX_QUERIES = 64;
+    static constexpr std::size_t FRAMES_IN_FLIGHT = 3;
+
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+
+    /**
+     * @brief Time the following draw calls as `pass`, use `GPUTimerScope`
+     * instead where possible.
+     *
+     * @param pass Usually a string literal. It must outlive the timer,
+     * passes are told apart by pointer first and by content after.
+     */
+    static void Begin(const char *pass);
+    /**
+     * @brief Stop timing until the next `Begin()`.
+     */
+    static void End();
+    /**
+     * @brief The pass being timed, `nullptr` if none.
+     */
+    static const char *GetCurrentPass();
+
+    /**
+     * @brief Close the frame that was just presented and read back the one
+     * from `FRAMES_IN_FLIGHT - 1` frames ago.
+     * @warning It is called by Core::Context::Update() already.
+     */
+    static void NewFrame();
+
+    /**
+     * @brief Passes seen so far, in the order they were first drawn.
+     */
+    static std::size_t GetPassCount();
+    static const char *GetPassName(std::size_t pass);
+    /**
+     * @brief GPU time of `pass` in the latest frame read back.
+     */
+    static float GetPassMs(std::size_t pass);
+    /**
+     * @brief Average GPU time of `pass` per frame read back since the last
+     * `ResetStats()`.
+     */
+    static float GetAverageMs(std::size_t pass);
+
+    static const Stats &GetStats();
+    /**
+     * @brief Restart the averages and `GetStats()` counts.
+     */
+    static void ResetStats();
+
+    /**
+     * @brief Show the pass times as an ImGui table.
+     *
+     * Must be called between `Core::Context::Setup()` and
+     * `Core::Context::Update()`.
+     */
+    static void DrawWindow();
+
+private:
+    struct Frame {
+        std::array<GLuint, MAX_QUERIES> queries = {};
+        std::array<std::size_t, MAX_QUERIES> passes = {};
+        std::size_t count = 0;
+    };
+
+    static std::size_t FindPass(const char *pass);
+    static void Collect(Frame &frame);
+
+    static bool s_Enabled;
+    static bool s_Initialized;
+    static std::array<Frame, FRAMES_IN_FLIGHT> s_Frames;
+    static std::size_t s_Current;
+    /// Pass of the running query, `MAX_PASSES` while none runs.
+    static std::size_t s_Running;
+
+    static std::array<const char *, MAX_PASSES> s_Names;
+    static std::size_t s_PassCount;
+    static std::array<float, MAX_PASSES> s_LastMs;
+    static std::array<double, MAX_PASSES> s_TotalMs;
+    static Stats s_Stats;
+};
+
+/**
+ * @class GPUTimerScope
+ * @brief Times draw calls as `pass` while alive, then goes back to timing
+ * whatever pass it interrupted.
+ */
+class GPUTimerScope {
+public:
+    explicit GPUTimerScope(const char *pass);
+    GPUTimerScope(const GPUTimerScope &) = delete;
+    GPUTimerScope(GPUTimerScope &&) = delete;
+
+    ~GPUTimerScope();
+
+    GPUTimerScope &operator=(const GPUTimerScope &) = delete;
+    GPUTimerScope &operator=(GPUTimerScope &&) = delete;
+
+private:
+    const char *m_Previous;
+};
+} // namespace Core
+
+#endif
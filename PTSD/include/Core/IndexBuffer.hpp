@@ -24,10 +24,17 @@ public:
     void Bind() const;
     void Unbind() const;
 
+    /**
+     * @brief Replace the indices, the owning `VertexArray` must be bound since
+     * `GL_ELEMENT_ARRAY_BUFFER` is part of its state.
+     */
+    void SetData(const std::vector<unsigned int> &indices);
+
 private:
     GLuint m_BufferId;
 
     size_t m_Count;
+    size_t m_Capacity;
 };
 } // namespace Core
 
@@ -0,0 +1,74 @@
+#ifndef CORE_OVERDRAW_VIEW_HPP
+#define CORE_OVERDRAW_VIEW_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+#include "Core/Program.hpp"
+#include "Core/VertexArray.hpp"
+
+namespace Core {
+/**
+ * @class OverdrawView
+ * @brief Debug mode showing how many times each pixel is shaded.
+ *
+ * While enabled, `SpriteBatch` draws into an offscreen single channel float
+ * target instead of the window. Every fragment that survives the depth test
+ * adds 1 through additive blending. Before the buffers are swapped the
+ * counts are shown as a heatmap over the whole window, black being untouched
+ * and red being 4 or more.
+ *
+ * The average count over the window is read back from the smallest mipmap of
+ * the target, so the driver does the reduction.
+ *
+ * @note Only batched sprites are counted. Text and custom drawables keep
+ * drawing into the window and are hidden by the heatmap.
+ */
+class OverdrawView {
+public:
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled() { return s_Enabled; }
+
+    /**
+     * @brief Redirect the following draws into the counting target, with the
+     * counting program bound.
+     */
+    static void Begin();
+
+    /**
+     * @brief Return to the window and the usual blending.
+     */
+    static void End();
+
+    /**
+     * @brief Read this frame's average, draw the heatmap and clear the counts
+     * for the next frame. Call before swapping the buffers.
+     */
+    static void Present();
+
+    /**
+     * @brief Average number of fragments per pixel in the last presented
+     * frame.
+     */
+    static float GetLastAverage() { return s_LastAverage; }
+
+private:
+    static void Init();
+    static void Clear();
+
+    static constexpr int UNIFORM_SURFACE_LOCATION = 0;
+
+    static bool s_Enabled;
+    static float s_LastAverage;
+
+    static GLuint s_Framebuffer;
+    static GLuint s_CountTexture;
+    static GLuint s_DepthBuffer;
+    static GLint s_TopLevel;
+
+    static std::unique_ptr<Program> s_CountProgram;
+    static std::unique_ptr<Program> s_HeatmapProgram;
+    static std::unique_ptr<VertexArray> s_Quad;
+};
+} // namespace Core
+
+#endif
@@ -9,11 +9,18 @@ namespace Core {
  * and linked together. A typical program would require at least a vertex shader
  * and a fragment shader. However, users could add more optional middle layers
  * such as geometry shaders or tesselation shaders.
+ *
+ * Linked binaries are kept in `ProgramCache`, so only the first run on a
+ * driver compiles from source.
  */
 class Program {
 public:
+    /**
+     * @param defines Passed to both shaders, see `Shader::Shader()`.
+     */
     Program(const std::string &vertexShaderFilepath,
-            const std::string &fragmentShaderFilepath);
+            const std::string &fragmentShaderFilepath,
+            const std::vector<std::string> &defines = {});
     Program(const Program &) = delete;
     Program(Program &&other);
 
@@ -24,15 +31,28 @@ public:
 
     GLuint GetId() const { return m_ProgramId; }
 
+    /**
+     * @brief `glGetUniformLocation()`, asked once per name.
+     *
+     * Returns -1 for uniforms the compiler optimized away, which every
+     * `glUniform*()` call silently ignores.
+     */
+    GLint GetUniformLocation(const std::string &name) const;
+
     void Bind() const;
     void Unbind() const;
 
+    /**
+     * @brief Runs `glValidateProgram()`, only when the validation tier is
+     * `ValidationTier::FULL`. Otherwise this is a no-op.
+     */
     void Validate() const;
 
 private:
-    void CheckStatus() const;
+    bool CheckStatus() const;
 
     GLuint m_ProgramId;
+    mutable std::unordered_map<std::string, GLint> m_UniformLocations;
 };
 } // namespace Core
 #endif
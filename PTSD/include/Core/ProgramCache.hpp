@@ -0,0 +1,63 @@
+#ifndef CORE_PROGRAM_CACHE_HPP
+#define CORE_PROGRAM_CACHE_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+namespace Core {
+/**
+ * @class ProgramCache
+ * @brief Linked program binaries kept on disk between runs.
+ *
+ * `Program` looks a key up here before compiling anything. The key hashes
+ * both shader sources, including injected defines, together with the
+ * vendor, renderer and version strings of the driver, so a driver update or
+ * a moved GPU misses instead of loading an incompatible binary.
+ *
+ * Binaries the driver rejects are treated as misses and overwritten after
+ * the program is built from source again.
+ *
+ * @see PROGRAM_BINARY_CACHE_DIR in config.hpp
+ */
+class ProgramCache {
+public:
+    struct Stats {
+        /// Programs loaded from a stored binary.
+        unsigned int hits = 0;
+        /// Programs built from source.
+        unsigned int misses = 0;
+    };
+
+    /**
+     * @brief Key of a program built from these sources on this driver.
+     */
+    static std::string MakeKey(const std::string &vertexSource,
+                               const std::string &fragmentSource);
+
+    /**
+     * @brief Load the binary stored under `key` into `program`.
+     *
+     * @return Whether `program` is linked and ready to use.
+     */
+    static bool Load(GLuint program, const std::string &key);
+
+    /**
+     * @brief Store the binary of the freshly linked `program` under `key`.
+     */
+    static void Store(GLuint program, const std::string &key);
+
+    /**
+     * @brief Whether the driver can hand out program binaries at all and a
+     * cache directory is configured.
+     */
+    static bool IsEnabled();
+
+    static const Stats &GetStats() { return s_Stats; }
+
+private:
+    static std::string GetPath(const std::string &key);
+
+    static Stats s_Stats;
+};
+} // namespace Core
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef CORE_PROGRAM_VARIANTS_HPP
+#define CORE_PROGRAM_VARIANTS_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+#include <cstdint>
+#include <functional>
+
+#include "Core/Program.hpp"
+
+namespace Core {
+/**
+ * @class ProgramVariants
+ * @brief Specialized builds of one shader pair, compiled on first use.
+ *
+ * Each bit of a variant mask stands for one preprocessor symbol. Asking for a
+ * mask compiles the pair with `#define` lines for its set bits and caches the
+ * result, so shaders can replace runtime branches on mode uniforms with
+ * `#ifdef` blocks the compiler strips.
+ *
+ * @code
+ * ProgramVariants variants("Shape.vert", "Shape.frag", {"HOLLOW", "GLOW"});
+ * variants.Get(0b10).Bind(); // compiled with `#define GLOW`
+ * @endcode
+ */
+class ProgramVariants {
+public:
+    using Mask = std::uint32_t;
+    /**
+     * @brief Called once on every new program, e.g. to bind uniform blocks.
+     */
+    using Initializer = std::function<void(const Program &)>;
+
+    /**
+     * @param defines Symbol of bit `i` at index `i`.
+     */
+    ProgramVariants(std::string vertexShaderFilepath,
+                    std::string fragmentShaderFilepath,
+                    std::vector<std::string> defines,
+                    Initializer initializer = nullptr);
+
+    /**
+     * @brief The program for `mask`, compiling it if this is the first request.
+     *
+     * Bits without a symbol are ignored.
+     */
+    Program &Get(Mask mask);
+
+    /**
+     * @brief Number of variants compiled so far.
+     */
+    size_t GetCompiledCount() const { return m_Programs.size(); }
+
+private:
+    std::string m_VertexShaderFilepath;
+    std::string m_FragmentShaderFilepath;
+    std::vector<std::string> m_Defines;
+    Initializer m_Initializer;
+
+    std::unordered_map<Mask, std::unique_ptr<Program>> m_Programs;
+};
+} // namespace Core
+
+#endif
@@ -14,7 +14,12 @@ public:
         FRAGMENT = GL_FRAGMENT_SHADER,
     };
 
-    Shader(const std::string &filepath, Type shaderType);
+    /**
+     * @param defines Names emitted as `#define` lines right after the
+     * `#version` directive, in order.
+     */
+    Shader(const std::string &filepath, Type shaderType,
+           const std::vector<std::string> &defines = {});
     Shader(const Shader &) = delete;
     Shader(Shader &&other);
 
@@ -25,6 +30,13 @@ public:
 
     GLuint GetShaderId() const { return m_ShaderId; }
 
+    /**
+     * @brief Insert a `#define` line per name into `src`, after `#version`
+     * when `src` starts with one, past any BOM, whitespace and comments.
+     */
+    static std::string InjectDefines(const std::string &src,
+                                     const std::vector<std::string> &defines);
+
 private:
     void Compile(const std::string &src) const;
     void CheckStatus(const std::string &filepath) const;
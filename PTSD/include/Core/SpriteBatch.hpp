@@ -0,0 +1,102 @@
+#ifndef CORE_SPRITE_BATCH_HPP
+#define CORE_SPRITE_BATCH_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+#include "Core/Drawable.hpp"
+#include "Core/Program.hpp"
+#include "Core/Texture.hpp"
+#include "Core/VertexArray.hpp"
+
+namespace Core {
+/**
+ * @class SpriteBatch
+ * @brief Collects textured quads and draws each run sharing a texture with a
+ * single call.
+ *
+ * `Util::Image` submits here instead of drawing directly. The quads are
+ * transformed on the CPU and streamed into one dynamic vertex buffer.
+ *
+ * Pending sprites are flushed before anything else draws
+ * (`FrameUniforms::Upload()`), when the camera changes, at the end of
+ * `Util::Renderer::Update()` and before the buffers are swapped, so the order
+ * between batched and unbatched drawables is kept.
+ *
+ * Inside a flush opaque sprites are drawn first, nearest first with blending
+ * off, so the depth test rejects the pixels they hide before shading. The
+ * translucent ones follow back to front with blending on. Both passes group
+ * sprites sharing a z-index by texture, the renderer gives no order to those
+ * anyway.
+ *
+ * While `OverdrawView` is enabled both passes are drawn into its counting
+ * target instead.
+ */
+class SpriteBatch {
+public:
+    struct Stats {
+        /// Quads submitted.
+        unsigned int sprites = 0;
+        /// Draw calls issued for them.
+        unsigned int draws = 0;
+        /// Quads drawn in the opaque pass.
+        unsigned int opaque = 0;
+    };
+
+    /**
+     * @brief Queue a unit quad transformed by `data.m_Model`, textured with
+     * `texture`.
+     *
+     * @param opaque Every texel of `texture` has full alpha, see
+     * `IsSurfaceOpaque()`.
+     */
+    static void Submit(const Texture &texture, const Matrices &data,
+                       bool opaque = false);
+
+    /**
+     * @brief Draw everything queued so far.
+     */
+    static void Flush();
+
+    /**
+     * @brief Close the frame's statistics, call once per frame.
+     */
+    static void NewFrame();
+
+    static Stats GetLastFrameStats() { return s_LastFrameStats; }
+
+private:
+    struct Sprite {
+        GLuint texture;
+        float z;
+        bool opaque;
+        std::array<glm::vec3, 4> corners;
+    };
+
+    static void Init();
+    /**
+     * @brief Draw sprites `[first, last)` with the bound program, one call per
+     * texture run.
+     */
+    static void DrawRuns(size_t first, size_t last);
+    /**
+     * @brief Make the UV and index buffers hold at least `count` quads.
+     */
+    static void Reserve(size_t count);
+
+    static constexpr int UNIFORM_SURFACE_LOCATION = 0;
+
+    static std::unique_ptr<Program> s_Program;
+    static std::unique_ptr<Program> s_OpaqueProgram;
+    static std::unique_ptr<VertexArray> s_VertexArray;
+
+    static std::vector<Sprite> s_Sprites;
+    static std::vector<float> s_Positions;
+    static size_t s_Capacity;
+    static glm::mat4 s_ViewProjection;
+
+    static Stats s_Stats;
+    static Stats s_LastFrameStats;
+};
+} // namespace Core
+
+#endif
@@ -6,7 +6,17 @@
 namespace Core {
 class Texture {
 public:
-    Texture(GLint format, int width, int height, const void *data);
+    enum class Filter {
+        LINEAR,
+        /**
+         * Mipmapped, for textures drawn smaller than their size. Costs a
+         * third more memory.
+         */
+        TRILINEAR,
+    };
+
+    Texture(GLint format, int width, int height, const void *data,
+            Filter filter = Filter::LINEAR);
     Texture(const Texture &) = delete;
     Texture(Texture &&texture);
 
@@ -16,14 +26,31 @@ public:
     Texture &operator=(Texture &&other);
 
     GLuint GetTextureId() const { return m_TextureId; }
+    Filter GetFilter() const { return m_Filter; }
 
     void Bind(int slot) const;
     void Unbind() const;
 
+    /**
+     * @brief Replace the whole image, regenerating mipmaps if the texture is
+     * trilinear.
+     */
     void UpdateData(GLint format, int width, int height, const void *data);
 
+    /**
+     * @brief Overwrite a rectangle of the existing storage.
+     *
+     * @param rowLength Pixels per row in `data`, for surfaces whose pitch is
+     * wider than `width`.
+     *
+     * @note Mipmaps are not regenerated.
+     */
+    void UpdateSubData(int x, int y, int width, int height, GLint format,
+                       int rowLength, const void *data);
+
 private:
     GLuint m_TextureId;
+    Filter m_Filter;
 };
 } // namespace Core
 
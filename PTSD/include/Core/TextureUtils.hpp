@@ -9,6 +9,25 @@ namespace Core {
 GLint SdlFormatToGlFormat(Uint32 format);
 
 GLint GlFormatToGlInternalFormat(GLint format);
+
+/**
+ * @brief Whether every pixel of `surface` is fully opaque.
+ *
+ * Formats without an alpha channel are opaque by definition, the others are
+ * scanned once.
+ */
+bool IsSurfaceOpaque(SDL_Surface *surface);
+
+/**
+ * @brief Copy of `surface` halved `levels` times, rounding odd sizes up.
+ *
+ * Colors are averaged weighted by their alpha, so transparent pixels don't
+ * darken the edges of a sprite.
+ *
+ * @return A new `SDL_PIXELFORMAT_RGBA32` surface owned by the caller, or
+ * nullptr if `surface` can't be converted.
+ */
+SDL_Surface *DownscaleSurface(SDL_Surface *surface, int levels);
 } // namespace Core
 
 #endif
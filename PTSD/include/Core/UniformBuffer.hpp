@@ -19,6 +19,13 @@ template <typename T>
 class UniformBuffer {
 public:
     UniformBuffer(const Program &program, const std::string &name, int binding);
+    /**
+     * @brief Create a buffer on `binding` without tying it to a program.
+     *
+     * Programs opt in later with `glUniformBlockBinding()`, this is how a
+     * block is shared between several programs.
+     */
+    explicit UniformBuffer(int binding);
     UniformBuffer(const UniformBuffer &) = delete;
     UniformBuffer(UniformBuffer &&other);
 
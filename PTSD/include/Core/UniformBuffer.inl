@@ -1,21 +1,26 @@
 #include "UniformBuffer.hpp"
 
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
+
 namespace Core {
 template <typename T>
 UniformBuffer<T>::UniformBuffer(const Program &program, const std::string &name,
                                 int binding)
-    : m_Binding(binding) {
+    : UniformBuffer(binding) {
     GLint uniformBlockIndex =
-        glGetUniformBlockIndex(program.GetId(), name.c_str());
-    glUniformBlockBinding(program.GetId(), uniformBlockIndex, binding);
-
-    glGenBuffers(1, &m_BufferId);
-    glBindBuffer(GL_UNIFORM_BUFFER, m_BufferId);
-    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(sizeof(T)), nullptr,
-                 GL_DYNAMIC_DRAW);
-    glBindBufferBase(GL_UNIFORM_BUFFER, m_Binding, m_BufferId);
+        GL().GetUniformBlockIndex(program.GetId(), name.c_str());
+    GL().UniformBlockBinding(program.GetId(), uniformBlockIndex, binding);
+}
 
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+template <typename T>
+UniformBuffer<T>::UniformBuffer(int binding)
+    : m_Binding(binding) {
+    GL().GenBuffers(1, &m_BufferId);
+    GLState::BindUniformBuffer(m_BufferId);
+    GL().BufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(sizeof(T)),
+                    nullptr, GL_DYNAMIC_DRAW);
+    GLState::BindUniformBufferBase(m_Binding, m_BufferId);
 }
 
 template <typename T>
@@ -26,7 +31,8 @@ UniformBuffer<T>::UniformBuffer(UniformBuffer &&other) {
 
 template <typename T>
 UniformBuffer<T>::~UniformBuffer() {
-    glDeleteBuffers(1, &m_BufferId);
+    GLState::ForgetBuffer(m_BufferId);
+    GL().DeleteBuffers(1, &m_BufferId);
 }
 
 template <typename T>
@@ -39,9 +45,9 @@ UniformBuffer<T> &UniformBuffer<T>::operator=(UniformBuffer &&other) {
 
 template <typename T>
 void UniformBuffer<T>::SetData(int offset, const T &data) {
-    glBindBuffer(GL_UNIFORM_BUFFER, m_BufferId);
-    glBufferSubData(GL_UNIFORM_BUFFER, offset,
-                    static_cast<GLsizeiptr>(sizeof(T)), &data);
-    glBindBufferBase(GL_UNIFORM_BUFFER, m_Binding, m_BufferId);
+    GLState::BindUniformBuffer(m_BufferId);
+    GL().BufferSubData(GL_UNIFORM_BUFFER, offset,
+                       static_cast<GLsizeiptr>(sizeof(T)), &data);
+    GLState::BindUniformBufferBase(m_Binding, m_BufferId);
 }
 } // namespace Core
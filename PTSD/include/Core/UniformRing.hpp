@@ -0,0 +1,61 @@
+#ifndef CORE_UNIFORM_RING_HPP
+#define CORE_UNIFORM_RING_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+namespace Core {
+/**
+ * @brief One large `GL_UNIFORM_BUFFER` that hands out short-lived slices.
+ *
+ * Each `Push()` copies a block into the next free slice and binds it with
+ * `glBindBufferRange()`, so many draws share one buffer object instead of
+ * owning a `UniformBuffer` each.
+ *
+ * With `ARB_buffer_storage` the buffer is persistently mapped and split into
+ * segments guarded by fences, one segment per frame in flight. Without it the
+ * buffer is written with `glBufferSubData()` and orphaned when it runs out.
+ */
+class UniformRing {
+public:
+    UniformRing(GLuint binding, GLsizeiptr segmentSize,
+                unsigned int segmentCount = 3);
+    UniformRing(const UniformRing &) = delete;
+    UniformRing(UniformRing &&) = delete;
+
+    ~UniformRing();
+
+    UniformRing &operator=(const UniformRing &) = delete;
+    UniformRing &operator=(UniformRing &&) = delete;
+
+    template <typename T>
+    void Push(const T &data) {
+        Push(&data, static_cast<GLsizeiptr>(sizeof(T)));
+    }
+
+    void Push(const void *data, GLsizeiptr size);
+
+    /**
+     * @brief Fence the slices used this frame and move to the next segment.
+     */
+    void NextFrame();
+
+    bool IsPersistent() const { return m_Mapped != nullptr; }
+
+private:
+    void NextSegment();
+
+    GLuint m_Binding;
+    GLuint m_BufferId = 0;
+
+    GLsizeiptr m_SegmentSize;
+    GLint m_Alignment = 256;
+
+    unsigned int m_Segment = 0;
+    GLsizeiptr m_Offset = 0;
+    std::vector<GLsync> m_Fences;
+
+    char *m_Mapped = nullptr;
+};
+} // namespace Core
+
+#endif
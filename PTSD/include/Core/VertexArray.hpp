@@ -30,13 +30,31 @@ public:
     void Bind() const;
     void Unbind() const;
 
-    void AddVertexBuffer(std::unique_ptr<VertexBuffer> vertexBuffer);
+    /**
+     * @param divisor Passed to `glVertexAttribDivisor()`. 0 advances the
+     * attribute per vertex, 1 advances it per instance.
+     */
+    void AddVertexBuffer(std::unique_ptr<VertexBuffer> vertexBuffer,
+                         GLuint divisor = 0);
     /**
      * Index buffer must be set or else there will be a segfault
      */
     void SetIndexBuffer(std::unique_ptr<IndexBuffer> indexBuffer);
 
+    VertexBuffer &GetVertexBuffer(size_t index) {
+        return *m_VertexBuffers[index];
+    }
+    IndexBuffer &GetIndexBuffer() { return *m_IndexBuffer; }
+
     void DrawTriangles() const;
+    /**
+     * @brief Draw `count` indices starting at index `first`.
+     */
+    void DrawTriangleRange(GLsizei first, GLsizei count) const;
+    /**
+     * @brief Draw the indexed triangles `instanceCount` times in one call.
+     */
+    void DrawTrianglesInstanced(GLsizei instanceCount) const;
 
 private:
     GLuint m_ArrayId;
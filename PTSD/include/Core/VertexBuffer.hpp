@@ -25,8 +25,17 @@ public:
     void Bind() const;
     void Unbind() const;
 
+    /**
+     * @brief Replace the content of the buffer.
+     *
+     * Storage is only reallocated when the new data doesn't fit, so calling
+     * this every time a text changes is cheap.
+     */
+    void SetData(const std::vector<float> &vertices);
+
 private:
     GLuint m_BufferId;
+    size_t m_Capacity;
 
     unsigned int m_ComponentCount;
     GLenum m_Type = GL_FLOAT;
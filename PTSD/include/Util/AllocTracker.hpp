@@ -0,0 +1,124 @@
+#ifndef UTIL_ALLOC_TRACKER_HPP
+#define UTIL_ALLOC_TRACKER_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+namespace Util {
+/**
+ * @class AllocTracker
+ * @brief Counts heap allocations per frame by the subsystem that made them.
+ *
+ * Only built in with the CMake option `PTSD_ENABLE_ALLOC_TRACKING`, which
+ * defines `PTSD_ALLOC_TRACKING` and replaces the global `operator new` and
+ * `operator delete`. Every allocation is charged to the innermost
+ * `PTSD_ALLOC_SCOPE` of its thread, or to `"untagged"` outside of one, and
+ * freeing it is charged back to the same tag. Without the option the scopes
+ * expand to nothing, and the functions below do nothing and report no tags.
+ *
+ * `Core::Context::Update()` closes each frame. The last frame can be read
+ * with `GetLastFrame()`, shown with `DrawWindow()`, and written to a CSV file
+ * with one row per tag per frame.
+ *
+ * @code
+ * void Renderer::Update() {
+ *     PTSD_ALLOC_SCOPE("Renderer");
+ *     // Allocations from here to the end of the block count as "Renderer"
+ * }
+ * @endcode
+ */
+class AllocTracker {
+public:
+    /**
+     * @brief One tag during one frame.
+     */
+    struct TagStats {
+        const char *name = nullptr;
+        /// Allocations made.
+        unsigned long long count = 0;
+        /// Bytes requested by those allocations.
+        unsigned long long bytes = 0;
+        /// Bytes allocated under the tag and not yet freed, at the frame end.
+        unsigned long long liveBytes = 0;
+        /// Most bytes live at once during the frame.
+        unsigned long long peakLiveBytes = 0;
+    };
+
+    /// Tags past this many are charged to `"untagged"`.
+    static constexpr std::size_t MAX_TAGS = 64;
+
+    /**
+     * @brief Close the current frame and start counting the next one.
+     * @warning It is called by Core::Context::Update() already.
+     */
+    static void NewFrame();
+
+    /**
+     * @brief Tags seen so far, `"untagged"` being the first.
+     */
+    static std::size_t GetTagCount();
+    static TagStats GetLastFrame(std::size_t tag);
+
+    /**
+     * @brief Write every following frame to `path` as CSV, overwriting it.
+     *
+     * Rows are `frame,tag,count,bytes,live_bytes,peak_live_bytes`, tags that
+     * neither allocated nor held memory during a frame are left out.
+     */
+    static void StartCsv(const std::string &path);
+    static void StopCsv();
+    static bool IsWritingCsv();
+
+    /**
+     * @brief Show the last frame as an ImGui table.
+     *
+     * Must be called between `Core::Context::Setup()` and
+     * `Core::Context::Update()`.
+     */
+    static void DrawWindow();
+};
+
+/**
+ * @class AllocScope
+ * @brief Charges allocations of this thread to `tag` while alive, use
+ * `PTSD_ALLOC_SCOPE` instead of naming one directly.
+ *
+ * Scopes nest, the innermost wins.
+ */
+class AllocScope {
+public:
+    /**
+     * @param tag Name of the subsystem, usually a string literal. It must
+     * outlive the program, tags are told apart by pointer first and by
+     * content after.
+     */
+    explicit AllocScope(const char *tag);
+    AllocScope(const AllocScope &) = delete;
+    AllocScope(AllocScope &&) = delete;
+
+    ~AllocScope();
+
+    AllocScope &operator=(const AllocScope &) = delete;
+    AllocScope &operator=(AllocScope &&) = delete;
+
+private:
+    std::size_t m_Previous;
+};
+} // namespace Util
+
+#define PTSD_ALLOC_SCOPE_CONCAT_IMPL(a, b) a##b
+#define PTSD_ALLOC_SCOPE_CONCAT(a, b) PTSD_ALLOC_SCOPE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Charge allocations until the end of the enclosing block to `tag`
+ *
+ * Expands to nothing unless built with `PTSD_ENABLE_ALLOC_TRACKING`.
+ */
+#ifdef PTSD_ALLOC_TRACKING
+#define PTSD_ALLOC_SCOPE(tag)                                                  \
+    const ::Util::AllocScope PTSD_ALLOC_SCOPE_CONCAT(ptsdAllocScope,           \
+                                                     __LINE__)(tag)
+#else
+#define PTSD_ALLOC_SCOPE(tag) static_cast<void>(0)
+#endif
+
+#endif
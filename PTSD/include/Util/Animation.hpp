@@ -7,6 +7,7 @@
 
 #include "Core/Drawable.hpp"
 
+#include "Util/Clock.hpp"
 #include "Util/Image.hpp"
 
 namespace Util {
@@ -39,6 +40,15 @@ public:
               std::size_t interval, bool looping = true,
               std::size_t cooldown = 100);
 
+    /**
+     * @brief Constructor taking the frames as interned IDs.
+     * @param frames IDs of the frame files, in playing order.
+     * @see Animation(const std::vector<std::string> &, bool, std::size_t,
+     * bool, std::size_t)
+     */
+    Animation(AssetRange frames, bool play, std::size_t interval,
+              bool looping = true, std::size_t cooldown = 100);
+
     /**
      * @brief Get the interval between frames.
      * @return Interval between frames in milliseconds.
@@ -99,6 +109,11 @@ public:
      */
     void SetCooldown(int cooldown) { m_Cooldown = cooldown; }
 
+    /**
+     * @brief Set the clock the animation advances by, `GAME` by default.
+     */
+    void SetClockDomain(ClockDomain domain) { m_ClockDomain = domain; }
+
     /**
      * @brief Set the current frame of the animation.
      * @param index Index of the frame to set as current.
@@ -140,7 +155,8 @@ private:
     std::size_t m_Cooldown;
     bool m_IsChangeFrame = false;
 
-    unsigned long m_CooldownEndTime = 0;
+    ClockDomain m_ClockDomain = ClockDomain::GAME;
+    double m_CooldownEndTime = 0;
     double m_TimeBetweenFrameUpdate = 0;
 
     std::size_t m_Index = 0;
@@ -0,0 +1,88 @@
+#ifndef UTIL_ASSET_REGISTRY_HPP
+#define UTIL_ASSET_REGISTRY_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+#include <cstdint>
+#include <deque>
+#include <string_view>
+
+namespace Util {
+/**
+ * @brief Dense ID of an interned asset path, see `AssetRegistry`.
+ */
+using AssetId = std::uint32_t;
+
+/**
+ * @brief Consecutive asset IDs, e.g. the frames of one animation.
+ *
+ * Paths interned one after another get consecutive IDs, so a set of frames
+ * registered together can be passed around as two integers.
+ */
+struct AssetRange {
+    AssetId first = 0;
+    std::uint32_t count = 0;
+
+    /**
+     * @brief A range holding the single asset `id`.
+     */
+    static AssetRange Single(AssetId id) { return {id, 1}; }
+
+    AssetId operator[](std::size_t index) const {
+        return first + static_cast<AssetId>(index);
+    }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+};
+
+/**
+ * @class AssetRegistry
+ * @brief Interns asset paths into IDs usable as array indices.
+ *
+ * Every path is hashed once, when it is interned. Stores keyed by `AssetId`
+ * then find their entries by indexing instead of hashing the path again.
+ * IDs start at 0 and are never reused.
+ *
+ * @code
+ * const auto id = AssetRegistry::Intern("Resources/Image/cat.png");
+ * AssetRegistry::GetPath(id); // "Resources/Image/cat.png"
+ * @endcode
+ */
+class AssetRegistry {
+public:
+    struct Stats {
+        std::size_t assets = 0;
+        /// Characters held by the interned paths.
+        std::size_t pathBytes = 0;
+        /// Calls that had to hash a path.
+        unsigned int hashedLookups = 0;
+    };
+
+    /**
+     * @brief The ID of `path`, assigning the next free one if it is new.
+     */
+    static AssetId Intern(const std::string &path);
+
+    /**
+     * @brief The path `id` was interned from.
+     *
+     * @warning `id` must come from `Intern`.
+     */
+    static const std::string &GetPath(AssetId id) { return s_Paths[id]; }
+
+    /**
+     * @brief Number of interned paths, one more than the largest ID.
+     */
+    static std::size_t GetCount() { return s_Paths.size(); }
+
+    static const Stats &GetStats() { return s_Stats; }
+
+private:
+    // A deque keeps the strings in place, so the map can view them
+    static std::deque<std::string> s_Paths;
+    static std::unordered_map<std::string_view, AssetId> s_Ids;
+    static Stats s_Stats;
+};
+} // namespace Util
+
+#endif
@@ -4,6 +4,9 @@
 #include "pch.hpp" // IWYU pragma: export
 
 #include <functional>
+#include <list>
+
+#include "Util/AssetRegistry.hpp"
 
 namespace Util {
 /**
@@ -11,23 +14,44 @@ namespace Util {
  *
  * The AssetStore class template provides functionality for loading, storing,
  * and accessing potentially expensive resources. It uses a loader function to
- * load assets from filepaths and stores them in an unordered map for efficient
- * retrieval.
+ * load assets from filepaths and stores them in a vector indexed by the
+ * `AssetId` of each filepath, so lookups by ID don't hash anything.
+ *
+ * With a sizer and a byte budget, the least recently used assets are evicted
+ * once the store grows past the budget. Assets still referenced elsewhere,
+ * i.e. a `std::shared_ptr` with other owners, are never evicted, so the
+ * store may stay over budget until they are released.
  *
  * @tparam T The type of assets managed by the store.
  */
 template <typename T>
 class AssetStore {
 public:
+    struct Stats {
+        /// Approximate memory held by the stored assets.
+        std::size_t bytes = 0;
+        std::size_t entries = 0;
+        unsigned int hits = 0;
+        unsigned int misses = 0;
+        unsigned int evictions = 0;
+    };
+
     /**
      * @brief Constructs an AssetStore object with the specified loader
      * function.
      *
      * @param loader The function used to load assets of type T from filepaths.
      * Missing files should be handled inside loader.
+     * @param sizer Approximate bytes held by an asset. Without one every asset
+     * counts as 0 bytes and nothing is evicted.
+     * @param budget Bytes to stay under, 0 for no limit.
      */
-    AssetStore(std::function<T(const std::string &)> loader)
-        : m_Loader(loader) {}
+    AssetStore(std::function<T(const std::string &)> loader,
+               std::function<std::size_t(const T &)> sizer = nullptr,
+               std::size_t budget = 0)
+        : m_Loader(loader),
+          m_Sizer(sizer),
+          m_Budget(budget) {}
 
     /**
      * @brief Preload resources for future use.
@@ -37,7 +61,10 @@ public:
      *
      * @param filepath The filepath of the asset to load.
      */
-    void Load(const std::string &filepath);
+    void Load(const std::string &filepath) {
+        Load(AssetRegistry::Intern(filepath));
+    }
+    void Load(AssetId id);
 
     /**
      * @brief Retrieves the asset associated with the specified filepath.
@@ -49,7 +76,10 @@ public:
      * @param filepath The filepath of the asset to retrieve.
      * @return A shared pointer to the asset, or nullptr if not found.
      */
-    T Get(const std::string &filepath);
+    T Get(const std::string &filepath) {
+        return Get(AssetRegistry::Intern(filepath));
+    }
+    T Get(AssetId id);
 
     /**
      * @brief Removes the asset associated with the specified filepath from the
@@ -61,12 +91,45 @@ public:
      *
      * @param filepath The filepath of the asset to remove.
      */
-    void Remove(const std::string &filepath);
+    void Remove(const std::string &filepath) {
+        Remove(AssetRegistry::Intern(filepath));
+    }
+    void Remove(AssetId id);
+
+    /**
+     * @brief Sets the byte budget and evicts down to it right away.
+     *
+     * @param budget Bytes to stay under, 0 for no limit.
+     */
+    void SetBudget(std::size_t budget);
+    std::size_t GetBudget() const { return m_Budget; }
+
+    const Stats &GetStats() const { return m_Stats; }
 
 private:
+    struct Entry {
+        bool loaded = false;
+        T asset{};
+        std::size_t bytes = 0;
+        /// Position in `m_Recent`, valid while loaded.
+        std::list<AssetId>::iterator recent;
+    };
+
+    /**
+     * @brief Evicts unreferenced assets, least recently used first, until
+     * the store fits its budget.
+     */
+    void Trim();
+
     std::function<T(const std::string &)> m_Loader;
+    std::function<std::size_t(const T &)> m_Sizer;
+    std::size_t m_Budget;
 
-    std::unordered_map<std::string, T> m_Map;
+    /// Indexed by `AssetId`, grown as new IDs show up.
+    std::vector<Entry> m_Entries;
+    /// Loaded IDs, most recently used first.
+    std::list<AssetId> m_Recent;
+    Stats m_Stats;
 };
 } // namespace Util
 
@@ -1,25 +1,92 @@
 #include "Util/AssetStore.hpp"
 
 namespace Util {
+namespace detail {
 template <typename T>
-void AssetStore<T>::Load(const std::string &filepath) {
-    m_Map[filepath] = m_Loader(filepath);
+bool IsReferenced(const T & /*asset*/) {
+    return false;
 }
 
 template <typename T>
-T AssetStore<T>::Get(const std::string &filepath) {
-    auto result = m_Map.find(filepath);
-    if (result != m_Map.end()) {
-        return result->second;
+bool IsReferenced(const std::shared_ptr<T> &asset) {
+    return asset.use_count() > 1;
+}
+} // namespace detail
+
+template <typename T>
+void AssetStore<T>::Load(AssetId id) {
+    Remove(id);
+    if (id >= m_Entries.size()) {
+        m_Entries.resize(AssetRegistry::GetCount());
     }
 
-    Load(filepath);
+    auto &entry = m_Entries[id];
+    entry.asset = m_Loader(AssetRegistry::GetPath(id));
+    entry.bytes = m_Sizer ? m_Sizer(entry.asset) : 0;
+    entry.loaded = true;
+    m_Recent.push_front(id);
+    entry.recent = m_Recent.begin();
 
-    return m_Map[filepath];
+    m_Stats.bytes += entry.bytes;
+    m_Stats.entries = m_Recent.size();
 }
 
 template <typename T>
-void AssetStore<T>::Remove(const std::string &filepath) {
-    m_Map.erase(filepath);
+T AssetStore<T>::Get(AssetId id) {
+    if (id < m_Entries.size() && m_Entries[id].loaded) {
+        auto &entry = m_Entries[id];
+        m_Stats.hits++;
+        m_Recent.splice(m_Recent.begin(), m_Recent, entry.recent);
+        return entry.asset;
+    }
+
+    m_Stats.misses++;
+    Load(id);
+
+    // Held here so trimming can't evict what the caller is about to get
+    T asset = m_Entries[id].asset;
+    Trim();
+    return asset;
+}
+
+template <typename T>
+void AssetStore<T>::Remove(AssetId id) {
+    if (id >= m_Entries.size() || !m_Entries[id].loaded) {
+        return;
+    }
+
+    auto &entry = m_Entries[id];
+    m_Stats.bytes -= entry.bytes;
+    m_Recent.erase(entry.recent);
+    entry = Entry();
+    m_Stats.entries = m_Recent.size();
+}
+
+template <typename T>
+void AssetStore<T>::SetBudget(std::size_t budget) {
+    m_Budget = budget;
+    Trim();
+}
+
+template <typename T>
+void AssetStore<T>::Trim() {
+    if (m_Budget == 0) {
+        return;
+    }
+
+    auto it = m_Recent.end();
+    while (m_Stats.bytes > m_Budget && it != m_Recent.begin()) {
+        --it;
+        auto &entry = m_Entries[*it];
+        if (detail::IsReferenced(entry.asset)) {
+            continue;
+        }
+
+        m_Stats.bytes -= entry.bytes;
+        m_Stats.evictions++;
+        entry = Entry();
+        it = m_Recent.erase(it);
+    }
+    m_Stats.entries = m_Recent.size();
 }
 } // namespace Util
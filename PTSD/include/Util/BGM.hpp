@@ -107,6 +107,17 @@ public:
      */
     void Resume();
 
+    /**
+     * @brief Hit rate of the music shared by all instances.
+     *
+     * Music is streamed from its file while playing, so no bytes are counted
+     * and nothing is evicted.
+     */
+    static const AssetStore<std::shared_ptr<Mix_Music>>::Stats &
+    GetStoreStats() {
+        return s_Store.GetStats();
+    }
+
 private:
     static Util::AssetStore<std::shared_ptr<Mix_Music>> s_Store;
 
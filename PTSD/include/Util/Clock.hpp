@@ -0,0 +1,75 @@
+#ifndef UTIL_CLOCK_HPP
+#define UTIL_CLOCK_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+namespace Util {
+/**
+ * @brief The clocks `Util::Time` keeps.
+ */
+enum class ClockDomain {
+    /// Wall clock time, never paused or scaled.
+    REAL,
+    /// Simulation time, what gameplay, animations and effects advance by.
+    GAME,
+    /// Menus and HUD, keeps running while the game is paused or fast-forwarded.
+    UI,
+};
+
+/**
+ * @class Clock
+ * @brief One time domain, advanced once per frame by `Util::Time::Update()`.
+ *
+ * A clock runs at `GetScale()` times real time and stands still while
+ * paused. Times are kept as double milliseconds, still exact to well under a
+ * microsecond after months, where float milliseconds lose whole frames
+ * within hours.
+ *
+ * @code
+ * // Run the simulation at 8x for a soak test, menus stay real-time
+ * Util::Time::Game().SetScale(8.0);
+ * const double dt = Util::Time::Game().GetDeltaMs();
+ * @endcode
+ */
+class Clock {
+public:
+    /**
+     * @brief Time this clock has advanced since the start of the program.
+     */
+    double GetElapsedMs() const { return m_ElapsedMs; }
+
+    /**
+     * @brief How far this clock advanced during the last frame.
+     */
+    double GetDeltaMs() const { return m_DeltaMs; }
+
+    float GetDeltaSeconds() const {
+        return static_cast<float>(m_DeltaMs / 1000.0);
+    }
+
+    bool IsPaused() const { return m_Paused; }
+    void SetPaused(bool paused) { m_Paused = paused; }
+
+    double GetScale() const { return m_Scale; }
+    /**
+     * @param scale Speed relative to real time, negative values are clamped
+     * to 0.
+     */
+    void SetScale(double scale) { m_Scale = scale > 0.0 ? scale : 0.0; }
+
+private:
+    friend class Time;
+
+    void Advance(double realDeltaMs) {
+        m_DeltaMs = m_Paused ? 0.0 : realDeltaMs * m_Scale;
+        m_ElapsedMs += m_DeltaMs;
+    }
+
+    double m_ElapsedMs = 0.0;
+    double m_DeltaMs = 0.0;
+    double m_Scale = 1.0;
+    bool m_Paused = false;
+};
+} // namespace Util
+
+#endif
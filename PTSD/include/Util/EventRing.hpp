@@ -0,0 +1,71 @@
+#ifndef UTIL_EVENT_RING_HPP
+#define UTIL_EVENT_RING_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Util {
+/**
+ * @class EventRing
+ * @brief Fixed size queue between one producer and one consumer thread.
+ *
+ * `Push` and `Pop` never lock or allocate, so the producer can be a callback
+ * running on whatever thread SDL delivers events from. When the ring is full
+ * `Push` fails instead of waiting for the consumer.
+ *
+ * @tparam Capacity Number of slots, a power of two.
+ */
+template <typename T, std::size_t Capacity>
+class EventRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "EventRing capacity must be a power of two");
+
+public:
+    /**
+     * @brief Append `item`. Only call from the producer thread.
+     *
+     * @return false if the ring is full and `item` was dropped.
+     */
+    bool Push(const T &item) {
+        const std::size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head - m_Tail.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        m_Items[head & (Capacity - 1)] = item;
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest item. Only call from the consumer thread.
+     *
+     * @return false if the ring is empty and `item` is untouched.
+     */
+    bool Pop(T &item) {
+        const std::size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail == m_Head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = m_Items[tail & (Capacity - 1)];
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Items waiting, exact only when neither side is running.
+     */
+    std::size_t Size() const {
+        return m_Head.load(std::memory_order_acquire) -
+               m_Tail.load(std::memory_order_acquire);
+    }
+
+private:
+    std::array<T, Capacity> m_Items{};
+    // Separate cache lines, the two sides write them from different threads
+    alignas(64) std::atomic<std::size_t> m_Head{0};
+    alignas(64) std::atomic<std::size_t> m_Tail{0};
+};
+} // namespace Util
+
+#endif
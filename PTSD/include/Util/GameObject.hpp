@@ -152,6 +152,16 @@ public:
             m_Children.end());
     }
 
+    /**
+     * @brief Check whether the drawable lies entirely outside the window.
+     *
+     * The test uses the bounding circle of the scaled drawable, so rotation
+     * and pivot never cause a visible object to be skipped. Objects without
+     * a drawable are never reported, subclasses may draw something else in
+     * `Draw()`.
+     */
+    bool IsOutsideWindow() const;
+
     virtual void Draw();
 
 protected:
@@ -0,0 +1,92 @@
+#ifndef UTIL_GLYPH_ATLAS_HPP
+#define UTIL_GLYPH_ATLAS_HPP
+
+#include "pch.hpp" // IWYU pragma: export
+
+#include <functional>
+#include <map>
+
+#include "Core/Texture.hpp"
+
+namespace Util {
+/**
+ * @class GlyphAtlas
+ * @brief A font at one size, with its glyphs packed into a shared texture.
+ *
+ * Glyphs are rasterized the first time they are asked for and stay in the
+ * atlas afterwards, so laying out a string only reads cached metrics.
+ *
+ * When a new glyph no longer fits, the atlas is cleared and
+ * `GetGeneration()` goes up. Glyphs handed out before that point at stale
+ * texels, so users lay their strings out again, which rasterizes only the
+ * glyphs still in use.
+ *
+ * Atlases are shared through `Get()`, every `Util::Text` using the same font
+ * file and size draws from the same texture.
+ */
+class GlyphAtlas {
+public:
+    struct Glyph {
+        /// Size of the glyph cell in pixels
+        glm::vec2 size;
+        glm::vec2 uvMin;
+        glm::vec2 uvMax;
+        float advance;
+    };
+
+    /**
+     * @brief Get the atlas for `font` at `size`, opening the font if no one
+     * else is using it.
+     */
+    static std::shared_ptr<GlyphAtlas> Get(const std::string &font, int size);
+
+    GlyphAtlas(const std::string &font, int size);
+    GlyphAtlas(const GlyphAtlas &) = delete;
+    GlyphAtlas(GlyphAtlas &&) = delete;
+
+    GlyphAtlas &operator=(const GlyphAtlas &) = delete;
+    GlyphAtlas &operator=(GlyphAtlas &&) = delete;
+
+    /**
+     * @return The glyph for `codepoint`, or `nullptr` if it can't be rendered
+     * or is too large for even an empty atlas.
+     * @note It may clear the atlas to make room, see `GetGeneration()`.
+     */
+    const Glyph *GetGlyph(Uint32 codepoint);
+
+    /**
+     * @brief Times the atlas has been cleared, glyphs from an earlier
+     * generation must not be drawn.
+     */
+    unsigned int GetGeneration() const { return m_Generation; }
+
+    float GetLineSkip() const { return m_LineSkip; }
+    float GetHeight() const { return m_Height; }
+
+    const Core::Texture &GetTexture() const { return *m_Texture; }
+
+private:
+    bool Pack(int width, int height, glm::ivec2 &origin);
+    void Clear();
+
+    static constexpr int ATLAS_SIZE = 1024;
+    static constexpr int PADDING = 1;
+
+    std::unique_ptr<TTF_Font, std::function<void(TTF_Font *)>> m_Font;
+    std::unique_ptr<Core::Texture> m_Texture;
+    std::unordered_map<Uint32, Glyph> m_Glyphs;
+
+    float m_LineSkip = 0;
+    float m_Height = 0;
+
+    int m_ShelfX = PADDING;
+    int m_ShelfY = PADDING;
+    int m_ShelfHeight = 0;
+    unsigned int m_Generation = 0;
+
+    static std::map<std::pair<std::string, int>, std::weak_ptr<GlyphAtlas>>
+        s_Cache;
+};
+} // namespace Util
+
+#endif
@@ -3,13 +3,12 @@
 
 #include "pch.hpp" // IWYU pragma: export
 
+#include <array>
+
 #include <glm/fwd.hpp>
 
 #include "Core/Drawable.hpp"
-#include "Core/Program.hpp"
 #include "Core/Texture.hpp"
-#include "Core/UniformBuffer.hpp"
-#include "Core/VertexArray.hpp"
 
 #include "Util/AssetStore.hpp"
 #include "Util/Transform.hpp"
@@ -22,15 +21,51 @@ namespace Util {
  * This class encapsulates the properties and behaviors of an image.
  * It includes properties such as texture and surface.
  * It also includes behaviors such as drawing the image.
+ *
+ * Images of the same file share one texture, uploaded when the first of them
+ * is created and deleted with the last one.
+ *
+ * Images that are only ever drawn scaled down can say so with `maxScale`.
+ * They get a mipmapped texture, and below `IMAGE_DOWNSCALE_THRESHOLD` one
+ * cooked to a fraction of the file's resolution, so tiny icons stop
+ * sampling huge textures. `GetSize()` keeps reporting the file's size.
  */
 class Image : public Core::Drawable {
 public:
+    struct TextureStats {
+        /// Textures currently alive.
+        std::size_t textures = 0;
+        /// Approximate GPU memory of those textures, from the format the
+        /// driver is asked to allocate.
+        std::size_t bytes = 0;
+        /// Images that reused a texture instead of uploading.
+        unsigned int hits = 0;
+        unsigned int uploads = 0;
+        /// Time spent creating textures, decoding excluded.
+        float uploadMs = 0;
+        /// Downscaled textures read from `COOKED_TEXTURE_DIR`.
+        unsigned int cookedLoads = 0;
+        /// Downscaled textures computed from the file.
+        unsigned int cooks = 0;
+        /// Memory the alive downscaled textures save over full resolution.
+        std::size_t savedBytes = 0;
+    };
+
     /**
      * @brief Constructor that takes a file path to the image.
      *
      * @param filepath The file path to the image.
+     * @param maxScale Largest scale the image will be drawn at.
      */
-    explicit Image(const std::string &filepath);
+    explicit Image(const std::string &filepath, float maxScale = 1.0F);
+
+    /**
+     * @brief Constructor that takes the interned ID of the image file.
+     *
+     * @param id The ID of the file path, see `Util::AssetRegistry`.
+     * @param maxScale Largest scale the image will be drawn at.
+     */
+    explicit Image(AssetId id, float maxScale = 1.0F);
 
     /**
      * @brief Retrieves the size of the image.
@@ -39,46 +74,83 @@ public:
      *
      * @return The size of the image as a vec2(x, y).
      */
-    glm::vec2 GetSize() const override { return m_Size; };
+    glm::vec2 GetSize() const override;
 
     /**
      * @brief Sets the image to the specified file path.
      *
-     * This function sets the image to the specified file path.
+     * This function sets the image to the specified file path. Other images
+     * sharing the old texture are left untouched. The `maxScale` given at
+     * construction still applies.
      *
      * @param filepath The file path to the image.
      */
     void SetImage(const std::string &filepath);
+    void SetImage(AssetId id);
 
     /**
      * @brief Draws the image with a given transform and z-index.
      *
-     * This function draws the image at the specified z-index and applies the
-     * given transform.
+     * The quad is queued in `Core::SpriteBatch` and drawn together with the
+     * other images sharing its texture. Images without a single translucent
+     * pixel go to its opaque pass.
      *
-     * @param transform The transform to apply to the image.
-     * @param zIndex The z-index at which to draw the image.
+     * @param data The model and view-projection matrices of the image.
      */
     void Draw(const Core::Matrices &data) override;
 
+    /**
+     * @brief Memory and hit rate of the decoded images shared by all
+     * instances.
+     */
+    static const AssetStore<std::shared_ptr<SDL_Surface>>::Stats &
+    GetStoreStats() {
+        return s_Store.GetStats();
+    }
+
+    /**
+     * @brief Keep decoded pixels after uploading them, so other images from
+     * the same file skip decoding.
+     *
+     * @see RELEASE_IMAGE_PIXELS_AFTER_UPLOAD in config.hpp for the default
+     */
+    static void SetKeepPixels(bool keep) { s_KeepPixels = keep; }
+
+    static const TextureStats &GetTextureStats() { return s_TextureStats; }
+
 private:
-    void InitProgram();
-    void InitVertexArray();
-    void InitUniformBuffer();
+    struct SharedTexture;
 
-    static constexpr int UNIFORM_SURFACE_LOCATION = 0;
+    /// Full resolution and mipmapped, then halved once, twice, ...
+    static constexpr std::size_t TEXTURE_VARIANTS = 6;
+    using Variants = std::array<std::weak_ptr<SharedTexture>, TEXTURE_VARIANTS>;
 
-    static std::unique_ptr<Core::Program> s_Program;
-    static std::unique_ptr<Core::VertexArray> s_VertexArray;
-    std::unique_ptr<Core::UniformBuffer<Core::Matrices>> m_UniformBuffer;
+    /**
+     * @brief Variant of the texture for an image drawn at most `maxScale`.
+     *
+     * 0 is the plain full resolution texture, `n` the mipmapped one halved
+     * `n - 1` times.
+     */
+    static std::size_t GetVariant(float maxScale);
 
+    /**
+     * @brief The texture of `id`, uploading it if no image holds it.
+     */
+    static std::shared_ptr<SharedTexture> AcquireTexture(AssetId id,
+                                                         std::size_t variant);
+
+    /**
+     * @brief Textures alive, indexed by `AssetId`.
+     */
+    static std::vector<Variants> &GetTextures();
+
+    static bool s_KeepPixels;
+    static TextureStats s_TextureStats;
     static Util::AssetStore<std::shared_ptr<SDL_Surface>> s_Store;
 
 private:
-    std::unique_ptr<Core::Texture> m_Texture = nullptr;
-
-    std::string m_Path;
-    glm::vec2 m_Size;
+    std::shared_ptr<SharedTexture> m_Texture = nullptr;
+    std::size_t m_Variant;
 };
 } // namespace Util
 
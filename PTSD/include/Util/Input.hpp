@@ -6,6 +6,10 @@
 #include <SDL_events.h> // for SDL_Event
 #include <SDL_stdinc.h> // for Uint8
 
+#include <array>
+#include <bitset>
+
+#include "Util/EventRing.hpp"
 #include "Util/Keycode.hpp" // for Keycode
 
 namespace Util {
@@ -16,9 +20,24 @@ namespace Util {
 * @note This class is a singleton and constructable. Use is as follows: \n
             `Util::Input::IsKeyPressed(Keycode::A)`,
             `Util::Input::IsLButtonDown()`, etc.
+*
+* Key and mouse button events are timestamped by an SDL event watch the
+* moment SDL queues them and pass through a lock-free ring to `Update()`,
+* which applies them in order. Key state is a bitset indexed by `Keycode`,
+* so queries never hash or allocate.
 */
 class Input {
 public:
+    /**
+     * @brief A key or mouse button going down or up.
+     */
+    struct KeyEvent {
+        Keycode key;
+        bool down;
+        /// `SDL_GetPerformanceCounter()` when SDL queued the event.
+        Uint64 ticks;
+    };
+
     Input() = delete;
     Input(const Input &) = delete;
     Input(Input &&) = delete;
@@ -66,31 +85,53 @@ public:
     static bool IsKeyPressed(const Keycode &key);
 
     /**
-     * @brief Check if a specific key is being pressed.
+     * @brief Check if a specific key went down since the last update.
      *
-     * This function checks whether the given key is currently being pressed.
+     * Also true for a key tapped and released again within one frame, which
+     * `IsKeyPressed()` never sees.
      *
      * @param key The keycode of the key to check.
      *
-     * @return true if `key` is currently pressed, false otherwise.
+     * @return true if `key` was pressed since the last update, false
+     * otherwise.
      *
      * @see Util::Keycode
      */
     static bool IsKeyDown(const Keycode &key);
 
     /**
-     * @brief Check if a specific key is being un-pressed.
-     *
-     * This function checks whether the given key is currently being un-pressed.
+     * @brief Check if a specific key was released since the last update.
      *
      * @param key The keycode of the key to check.
      *
-     * @return true if `key` is currently pressed, false otherwise.
+     * @return true if `key` was released since the last update, false
+     * otherwise.
      *
      * @see Util::Keycode
      */
     static bool IsKeyUp(const Keycode &key);
 
+    /**
+     * @brief Milliseconds since `key` last went down or up.
+     *
+     * Measured from when SDL queued the event, so calling this where the
+     * game acts on an edge gives the input to action latency.
+     *
+     * @return 0 if `key` never changed.
+     */
+    static float GetEdgeAgeMs(const Keycode &key);
+
+    /**
+     * @brief The key and mouse button events applied by the last update,
+     * oldest first.
+     */
+    static const std::vector<KeyEvent> &GetKeyEvents() { return s_KeyEvents; }
+
+    /**
+     * @brief Events lost because the ring was full when SDL queued them.
+     */
+    static unsigned int GetDroppedEvents() { return s_DroppedEvents; }
+
     /**
      * @brief Checks if the mouse wheel is currently being scrolled.
      * @return  A bool value representing the current state of the mouse
@@ -129,20 +170,37 @@ public:
     static void Update();
 
 private:
-    static void UpdateKeyState(const SDL_Event *event);
+    /**
+     * @brief SDL event watch, runs on the thread that queues the event.
+     */
+    static int WatchEvent(void *userdata, SDL_Event *event);
+    static void ApplyKeyEvent(const KeyEvent &event);
+    static std::size_t ToIndex(const Keycode &key) {
+        return static_cast<std::size_t>(key);
+    }
+
+    // Scancodes, then `MOUSE_LB` and the other buttons from 512 up
+    static constexpr std::size_t KEY_COUNT = 520;
+    static constexpr std::size_t EVENT_RING_SIZE = 256;
 
     static SDL_Event s_Event;
 
     static glm::vec2 s_CursorPosition;
     static glm::vec2 s_ScrollDistance;
 
-    static std::unordered_map<Keycode, std::pair<bool, bool>> s_KeyState;
+    static std::bitset<KEY_COUNT> s_KeyHeld;
+    static std::bitset<KEY_COUNT> s_KeyPressed;
+    static std::bitset<KEY_COUNT> s_KeyReleased;
+    static std::array<Uint64, KEY_COUNT> s_EdgeTicks;
+
+    static EventRing<KeyEvent, EVENT_RING_SIZE> s_EventRing;
+    static std::vector<KeyEvent> s_KeyEvents;
+    static std::atomic<unsigned int> s_DroppedEvents;
+    static bool s_Watching;
 
     static bool s_Scroll;
     static bool s_MouseMoving;
     static bool s_Exit;
-
-    static ImGuiIO s_Io;
 };
 
 } // namespace Util
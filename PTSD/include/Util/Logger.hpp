@@ -3,10 +3,27 @@
 
 #include "pch.hpp" // IWYU pragma: export
 
+#include <chrono>
+
 #include <spdlog/spdlog.h>
 
 #include "Util/Transform.hpp"
 
+/**
+ * @brief Lowest level compiled in, as a `Util::Logger::Level` value
+ *
+ * Calls below it expand to nothing that runs, their arguments aren't even
+ * evaluated. Release builds keep INFO and above, pass
+ * `-DLOG_ACTIVE_LEVEL=<0-5>` to choose otherwise.
+ */
+#ifndef LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define LOG_ACTIVE_LEVEL 2
+#else
+#define LOG_ACTIVE_LEVEL 0
+#endif
+#endif
+
 namespace Util::Logger {
 /**
  * @enum Level
@@ -23,13 +40,44 @@ enum class Level {
     CRITICAL,
 };
 
+/**
+ * @brief Cost of logging, frame times on the thread that called `Init()`.
+ */
+struct Stats {
+    /// Messages handed to the background writer.
+    unsigned long long messages = 0;
+    /// Messages the writer never got to because the queue was full.
+    std::size_t dropped = 0;
+    /// Time spent logging during the last frame.
+    float lastFrameMs = 0;
+    /// Most time spent logging in any one frame.
+    float worstFrameMs = 0;
+};
+
 /**
  * @brief Initializes the logger.
  *
  * This function initializes the logger for the application.
+ *
+ * Messages are formatted on the calling thread and queued in a ring buffer
+ * that a background thread writes out, so logging never waits on the
+ * console. When the ring is full the oldest queued messages are dropped.
  */
 void Init();
 
+/**
+ * @brief Write out everything queued and stop the background writer.
+ */
+void Shutdown();
+
+/**
+ * @brief Close the logging time of the frame that just ended.
+ * @warning It is called by Core::Context::Update() already.
+ */
+void NewFrame();
+
+Stats GetStats();
+
 /**
  * @brief Sets the logging level.
  *
@@ -51,14 +99,72 @@ void SetLevel(Level level);
  */
 Level GetLevel();
 
-#define LOG_TRACE(...) spdlog::trace(__VA_ARGS__)
-#define LOG_DEBUG(...) spdlog::debug(__VA_ARGS__)
-#define LOG_INFO(...) spdlog::info(__VA_ARGS__)
-#define LOG_WARN(...) spdlog::warn(__VA_ARGS__)
-#define LOG_ERROR(...) spdlog::error(__VA_ARGS__)
-#define LOG_CRITICAL(...) spdlog::critical(__VA_ARGS__)
+namespace detail {
+void Record(std::chrono::steady_clock::duration time);
+
+template <typename T>
+void Write(spdlog::level::level_enum level, const T &message) {
+    auto *logger = spdlog::default_logger_raw();
+    if (!logger->should_log(level)) {
+        return;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    logger->log(level, message);
+    Record(std::chrono::steady_clock::now() - start);
+}
+
+template <typename... Args>
+void Write(spdlog::level::level_enum level,
+           spdlog::format_string_t<Args...> format, Args &&...args) {
+    auto *logger = spdlog::default_logger_raw();
+    if (!logger->should_log(level)) {
+        return;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    logger->log(level, format, std::forward<Args>(args)...);
+    Record(std::chrono::steady_clock::now() - start);
+}
+} // namespace detail
 } // namespace Util::Logger
 
+// Type checks the arguments of a stripped call without ever running it
+#define LOG_DISCARD(...)                                                       \
+    do {                                                                       \
+        if (false) {                                                           \
+            spdlog::trace(__VA_ARGS__);                                        \
+        }                                                                      \
+    } while (false)
+
+#define LOG_WRITE(severity, ...)                                               \
+    ::Util::Logger::detail::Write(spdlog::level::severity, __VA_ARGS__)
+
+#if LOG_ACTIVE_LEVEL <= 0
+#define LOG_TRACE(...) LOG_WRITE(trace, __VA_ARGS__)
+#else
+#define LOG_TRACE(...) LOG_DISCARD(__VA_ARGS__)
+#endif
+#if LOG_ACTIVE_LEVEL <= 1
+#define LOG_DEBUG(...) LOG_WRITE(debug, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) LOG_DISCARD(__VA_ARGS__)
+#endif
+#if LOG_ACTIVE_LEVEL <= 2
+#define LOG_INFO(...) LOG_WRITE(info, __VA_ARGS__)
+#else
+#define LOG_INFO(...) LOG_DISCARD(__VA_ARGS__)
+#endif
+#if LOG_ACTIVE_LEVEL <= 3
+#define LOG_WARN(...) LOG_WRITE(warn, __VA_ARGS__)
+#else
+#define LOG_WARN(...) LOG_DISCARD(__VA_ARGS__)
+#endif
+#if LOG_ACTIVE_LEVEL <= 4
+#define LOG_ERROR(...) LOG_WRITE(err, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) LOG_DISCARD(__VA_ARGS__)
+#endif
+#define LOG_CRITICAL(...) LOG_WRITE(critical, __VA_ARGS__)
+
 /*
  * I have no idea what this does
  *
@@ -48,12 +48,22 @@ public:
     /**
      * @brief Draw children according to their z-index.
      *
+     * Children lying entirely outside the window are skipped, see
+     * `GameObject::IsOutsideWindow()`.
+     *
      * @note The user is not recommended to modify this function.
      */
     void Update();
 
+    /**
+     * @brief Number of objects skipped by the last `Update()` because they
+     * were outside the window.
+     */
+    unsigned int GetCulledCount() const { return m_CulledCount; }
+
 private:
     std::vector<std::shared_ptr<GameObject>> m_Children;
+    unsigned int m_CulledCount = 0;
 };
 } // namespace Util
 
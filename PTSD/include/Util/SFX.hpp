@@ -91,6 +91,15 @@ public:
      */
     void FadeIn(unsigned int tick, int oop = -1, unsigned int duration = -1);
 
+    /**
+     * @brief Memory and hit rate of the decoded sound effects shared by all
+     * instances.
+     */
+    static const AssetStore<std::shared_ptr<Mix_Chunk>>::Stats &
+    GetStoreStats() {
+        return s_Store.GetStats();
+    }
+
 private:
     static Util::AssetStore<std::shared_ptr<Mix_Chunk>> s_Store;
 
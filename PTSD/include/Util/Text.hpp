@@ -3,15 +3,12 @@
 
 #include "pch.hpp" // IWYU pragma: export
 
-#include <functional>
-
 #include "Core/Drawable.hpp"
 #include "Core/Program.hpp"
-#include "Core/Texture.hpp"
-#include "Core/UniformBuffer.hpp"
 #include "Core/VertexArray.hpp"
 
 #include "Util/Color.hpp"
+#include "Util/GlyphAtlas.hpp"
 #include "Util/Transform.hpp"
 
 namespace Util {
@@ -20,8 +17,8 @@ namespace Util {
  * @brief A class representing a text.
  *
  * This class encapsulates the properties and behaviors of a text.
- * It includes properties such as texture and surface.
- * It also includes behaviors such as drawing the text.
+ * Glyphs come from a `GlyphAtlas` shared by every text with the same font and
+ * size, a string is laid out into one quad per glyph and drawn in one call.
  */
 class Text : public Core::Drawable {
 public:
@@ -36,8 +33,11 @@ public:
      * @param text The string to set.
      */
     void SetText(const std::string &text) {
+        if (text == m_Text) {
+            return;
+        }
         m_Text = text;
-        ApplyTexture();
+        UpdateLayout();
     }
 
     /**
@@ -45,10 +45,7 @@ public:
      *
      * @param color The color to set.
      */
-    void SetColor(const Util::Color &color) {
-        m_Color = color;
-        ApplyTexture();
-    };
+    void SetColor(const Util::Color &color) { m_Color = color; };
 
     /**
      * @brief Draws the text with a given transform and z-index.
@@ -61,24 +58,23 @@ public:
 private:
     void InitProgram();
     void InitVertexArray();
-    void InitUniformBuffer();
 
     /**
-     * @brief Applies the texture to the text.
-     * @note The user should call this function after updating the texture in
-     * case of custom methods/functions are used.
+     * @brief Rebuilds the glyph quads from `m_Text`, also when the atlas was
+     * cleared since the last time.
      */
-    void ApplyTexture();
+    void UpdateLayout();
 
     static constexpr int UNIFORM_SURFACE_LOCATION = 0;
 
     static std::unique_ptr<Core::Program> s_Program;
-    static std::unique_ptr<Core::VertexArray> s_VertexArray;
-    std::unique_ptr<Core::UniformBuffer<Core::Matrices>> m_UniformBuffer;
+    static GLint s_ColorLocation;
 
 private:
-    std::unique_ptr<Core::Texture> m_Texture = nullptr;
-    std::unique_ptr<TTF_Font, std::function<void(TTF_Font *)>> m_Font;
+    std::shared_ptr<GlyphAtlas> m_Atlas;
+    /// `GlyphAtlas::GetGeneration()` the quads were laid out against
+    unsigned int m_AtlasGeneration = 0;
+    std::unique_ptr<Core::VertexArray> m_VertexArray;
 
     std::string m_Text;
     Util::Color m_Color;
@@ -3,6 +3,8 @@
 
 #include "pch.hpp" // IWYU pragma: export
 
+#include "Util/Clock.hpp"
+
 namespace Util {
 
 using sdl_count_t = Uint64;
@@ -16,6 +18,10 @@ using ms_t = float;
  * This class provides functionalities such as getting the delta time between
  * frames.
  *
+ * `GetDeltaTimeMs()` and `GetElapsedTimeMs()` read real time. Code that
+ * should follow pause and fast-forward reads one of the clock domains
+ * instead, see `Util::Clock`.
+ *
  * @note It is designed as a singleton, meaning only one instance of this class
  * should exist. Therefore, the user should NOT create their own `Time` object.
  */
@@ -55,6 +61,15 @@ public:
      */
     static ms_t GetElapsedTimeMs();
 
+    /**
+     * @brief The clock of `domain`.
+     */
+    static Clock &GetClock(ClockDomain domain);
+
+    static const Clock &Real() { return s_Real; }
+    static Clock &Game() { return s_Game; }
+    static Clock &UI() { return s_UI; }
+
     /**
      * @brief Update the time.
      *
@@ -88,6 +103,10 @@ private:
      * the last frame.
      */
     static ms_t s_DeltaTime;
+
+    static Clock s_Real;
+    static Clock s_Game;
+    static Clock s_UI;
 };
 } // namespace Util
 
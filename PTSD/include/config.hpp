@@ -3,6 +3,8 @@
 
 #include "pch.hpp" // IWYU pragma: export
 
+#include "Core/FramePacer.hpp"
+#include "Core/GLState.hpp"
 #include "Util/Logger.hpp"
 
 constexpr const char *TITLE = "Practical Tools for Simple Design";
@@ -22,4 +24,108 @@ constexpr Util::Logger::Level DEFAULT_LOG_LEVEL = Util::Logger::Level::DEBUG;
  */
 constexpr unsigned int FPS_CAP = 60;
 
+/**
+ * @brief Swap interval of the window
+ *
+ * With vsync on, set `FPS_CAP` to 0 or to at most the refresh rate so the
+ * two don't fight over pacing.
+ */
+constexpr Core::VSyncMode VSYNC_MODE = Core::VSyncMode::OFF;
+
+/**
+ * @brief Bytes of decoded images kept for reuse, 0 for no limit
+ *
+ * Least recently used images are decoded again from disk once evicted.
+ */
+constexpr std::size_t IMAGE_STORE_BUDGET_BYTES = 256 * 1024 * 1024;
+
+/**
+ * @brief Bytes of decoded sound effects kept for reuse, 0 for no limit
+ */
+constexpr std::size_t SFX_STORE_BUDGET_BYTES = 64 * 1024 * 1024;
+
+/**
+ * @brief Whether `Util::Image` drops its decoded pixels once they are on the
+ * GPU
+ *
+ * Halves the memory of every image, but once no image of a file is left,
+ * creating one decodes the file again.
+ */
+constexpr bool RELEASE_IMAGE_PIXELS_AFTER_UPLOAD = false;
+
+/**
+ * @brief Scale below which `Util::Image` cooks a smaller texture
+ *
+ * Images created with a `maxScale` under this get a texture halved until it
+ * is just above the size they are drawn at.
+ */
+constexpr float IMAGE_DOWNSCALE_THRESHOLD = 0.5F;
+
+/**
+ * @brief Directory downscaled image textures are cooked into
+ *
+ * Relative to the working directory. Set to an empty string to downscale
+ * again on every run.
+ */
+constexpr const char *COOKED_TEXTURE_DIR = "cooked_textures";
+
+/**
+ * @brief Directory linked program binaries are cached in
+ *
+ * Relative to the working directory. Set to an empty string to always build
+ * programs from source.
+ */
+constexpr const char *PROGRAM_BINARY_CACHE_DIR = "program_cache";
+
+/**
+ * @brief Whether `Core::GPUTimer` times render passes from the start
+ *
+ * Costs a handful of timer queries per frame, so release builds leave it off.
+ * It can still be turned on from the overlay window.
+ */
+#ifdef NDEBUG
+constexpr bool GPU_PASS_TIMING = false;
+#else
+constexpr bool GPU_PASS_TIMING = true;
+#endif
+
+/**
+ * @brief Scale of `Util::Time::Game()` at startup
+ *
+ * Set it above 1 to fast-forward soak tests and balance sweeps on optimized
+ * builds, which have no key to change it while running.
+ */
+constexpr double GAME_CLOCK_SCALE = 1.0;
+
+/**
+ * @brief Directory every frame is captured to from startup, see
+ * `Core::Context::StartCapture()`
+ *
+ * Relative to the working directory. Empty to only capture on request, which
+ * is the only way release builds can record bug reports or trailers.
+ */
+constexpr const char *STARTUP_CAPTURE_DIR = "";
+
+/**
+ * @brief File the allocations window writes per-frame CSV rows to
+ *
+ * Only used when built with `PTSD_ENABLE_ALLOC_TRACKING`, see
+ * `Util::AllocTracker`.
+ */
+constexpr const char *ALLOC_TRACKING_CSV_PATH = "allocations.csv";
+
+/**
+ * @brief OpenGL debug output and program validation level
+ *
+ * `FULL` validates the program before every draw, only turn it on while
+ * hunting a GL error.
+ */
+#ifdef NDEBUG
+constexpr Core::ValidationTier DEFAULT_GL_VALIDATION_TIER =
+    Core::ValidationTier::NONE;
+#else
+constexpr Core::ValidationTier DEFAULT_GL_VALIDATION_TIER =
+    Core::ValidationTier::DEBUG_OUTPUT;
+#endif
+
 #endif
@@ -3,15 +3,22 @@
 #include <memory>
 
 #include "Core/DebugMessageCallback.hpp"
-
+#include "Core/FramePacer.hpp"
+#include "Core/FrameUniforms.hpp"
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
+#include "Core/GPUTimer.hpp"
+#include "Core/OverdrawView.hpp"
+#include "Core/ProgramCache.hpp"
+#include "Core/SpriteBatch.hpp"
+
+#include "Util/AllocTracker.hpp"
 #include "Util/Input.hpp"
 #include "Util/Logger.hpp"
 #include "Util/Time.hpp"
 
 #include "config.hpp"
 
-using Util::ms_t;
-
 namespace Core {
 Context::Context() {
     Util::Logger::Init();
@@ -67,16 +74,19 @@ Context::Context() {
         GLuint err = glGetError();
         LOG_ERROR(reinterpret_cast<const char *>(glewGetErrorString(err)));
     }
+    GLBackend::Use(GLBackendType::NATIVE);
 
 #ifndef __APPLE__
-    glEnable(GL_DEBUG_OUTPUT);
-    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
     glDebugMessageCallback(Core::OpenGLDebugMessageCallback, nullptr);
 #endif
+    GLState::SetValidationTier(DEFAULT_GL_VALIDATION_TIER);
+    FramePacer::SetVSync(VSYNC_MODE);
+    GPUTimer::SetEnabled(GPU_PASS_TIMING);
+    Util::Time::Game().SetScale(GAME_CLOCK_SCALE);
 
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    GLState::SetDepthTest(true);
+    GLState::SetBlend(true);
+    GLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     LOG_INFO("OpenGL Info");
     LOG_INFO("  Vendor: {}", glGetString(GL_VENDOR));
@@ -93,10 +103,17 @@ Context::Context() {
 
     ImGui_ImplSDL2_InitForOpenGL(m_Window, m_GlContext);
     ImGui_ImplOpenGL3_Init();
+
+    if (STARTUP_CAPTURE_DIR[0] != '\0') {
+        StartCapture(STARTUP_CAPTURE_DIR);
+    }
 }
 std::shared_ptr<Context> Context::s_Instance(nullptr);
 
 Context::~Context() {
+    // Needs the GL context for its last readbacks
+    m_Capture.reset();
+
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplSDL2_Shutdown();
     ImGui::DestroyContext();
@@ -111,26 +128,48 @@ Context::~Context() {
     IMG_Quit();
     Mix_Quit();
     SDL_Quit();
+
+    Util::Logger::Shutdown();
 }
 
 void Context::Setup() {
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplSDL2_NewFrame();
     ImGui::NewFrame();
+    m_ImGuiFrame = true;
 }
 
 void Context::Update() {
-    Util::Input::Update();
+    SpriteBatch::Flush();
+    OverdrawView::Present();
+    if (m_ImGuiFrame) {
+        GPUTimerScope timer("ImGui");
+        ImGui::Render();
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        m_ImGuiFrame = false;
+    }
+    if (m_Capture != nullptr) {
+        m_Capture->Capture();
+    }
     SDL_GL_SwapWindow(m_Window);
+    m_Pacer.Presented();
+    if (!m_FirstFrameShown) {
+        m_FirstFrameShown = true;
+        // Compare a run with an empty `PROGRAM_BINARY_CACHE_DIR` to a second one
+        const auto &cache = ProgramCache::GetStats();
+        LOG_INFO("First frame after {:.1f} ms, {} programs from the binary "
+                 "cache, {} built from source",
+                 Util::Time::GetElapsedTimeMs(), cache.hits, cache.misses);
+    }
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    GLState::NewFrame();
+    GPUTimer::NewFrame();
+    FrameUniforms::NewFrame();
+    SpriteBatch::NewFrame();
 
-    constexpr ms_t frameTime = FPS_CAP != 0 ? 1000.0F / FPS_CAP : 0;
-    ms_t afterUpdate = Util::Time::GetElapsedTimeMs();
-    ms_t updateTime = afterUpdate - m_BeforeUpdateTime;
-    if (updateTime < frameTime) {
-        SDL_Delay(static_cast<Uint32>(frameTime - updateTime));
-    }
-    m_BeforeUpdateTime = Util::Time::GetElapsedTimeMs();
+    Util::Logger::NewFrame();
+    Util::AllocTracker::NewFrame();
+    m_Pacer.Wait();
 
     // Here's a figure explaining how Delta time & Delay work:
     //
@@ -142,12 +181,41 @@ void Context::Update() {
     // # Updating/rendering time is denoted as "UT"
     Util::Time::Update();
 
+    // Late latch: read input after the wait, right before the app uses it,
+    // instead of carrying it through a whole delay
+    Util::Input::Update();
+    m_Pacer.Latch();
+
+    const auto pacing = m_Pacer.GetStats();
+    if (pacing.frames >= PACING_REPORT_FRAMES) {
+        // These reports are at INFO, the level release builds keep. Debug
+        // builds pace differently and log more, their figures say little
+        LOG_INFO("Frame pacing: p50 {:.2f} ms, p99 {:.2f} ms, jitter {:.2f} "
+                 "ms, input latched {:.2f} ms (max {:.2f} ms) before present",
+                 pacing.p50Ms, pacing.p99Ms, pacing.jitterMs,
+                 pacing.averageInputLatencyMs, pacing.maxInputLatencyMs);
+        const auto logging = Util::Logger::GetStats();
+        LOG_INFO("Logging: worst frame spent {:.3f} ms logging, {} messages, "
+                 "{} dropped",
+                 logging.worstFrameMs, logging.messages, logging.dropped);
+        if (GPUTimer::IsEnabled()) {
+            std::string passes;
+            for (std::size_t i = 0; i < GPUTimer::GetPassCount(); ++i) {
+                passes += fmt::format("{}{} {:.3f} ms", i == 0 ? "" : ", ",
+                                      GPUTimer::GetPassName(i),
+                                      GPUTimer::GetAverageMs(i));
+            }
+            const auto &gpu = GPUTimer::GetStats();
+            LOG_DEBUG("GPU passes: {} ({} frames, {} late)", passes,
+                      gpu.frames, gpu.late);
+            GPUTimer::ResetStats();
+        }
+        m_Pacer.ResetStats();
+    }
+
 #ifdef DEBUG_DELTA_TIME
     auto deltaTime = Util::Time::GetDeltaTimeMs();
-    LOG_DEBUG("Delta(Update+Delay): {:.1f}({:.1f}+{:.1f}) ms, FPS: {:.1f}",
-              deltaTime, updateTime,
-              updateTime < frameTime ? frameTime - updateTime : 0,
-              1000.0f / deltaTime);
+    LOG_DEBUG("Delta: {:.1f} ms, FPS: {:.1f}", deltaTime, 1000.0f / deltaTime);
 #endif // DEBUG_DELTA_TIME
 }
 
@@ -158,8 +226,31 @@ std::shared_ptr<Context> Context::GetInstance() {
     return s_Instance;
 }
 
+void Context::DestroyInstance() {
+    s_Instance.reset();
+}
+
 void Context::SetWindowIcon(const std::string &path) {
     SDL_Surface *image = IMG_Load(path.c_str());
     SDL_SetWindowIcon(m_Window, image);
 }
+
+void Context::StartCapture(const std::string &directory,
+                           FrameCapture::Format format) {
+    if (m_Capture != nullptr) {
+        LOG_WARN("Already capturing");
+        return;
+    }
+
+    int width = 0;
+    int height = 0;
+    SDL_GL_GetDrawableSize(m_Window, &width, &height);
+    m_Capture = std::make_unique<FrameCapture>(
+        directory, format, static_cast<unsigned int>(width),
+        static_cast<unsigned int>(height), FPS_CAP != 0 ? FPS_CAP : 60);
+}
+
+void Context::StopCapture() {
+    m_Capture.reset();
+}
 } // namespace Core
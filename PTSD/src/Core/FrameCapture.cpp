@@ -0,0 +1,251 @@
+#include "Core/FrameCapture.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+#include "Core/GLState.hpp"
+
+#include "Util/Logger.hpp"
+
+namespace Core {
+namespace {
+// A second without the GPU finishing a copy means something else is wrong
+constexpr GLuint64 FENCE_TIMEOUT_NS = 1000000000;
+} // namespace
+
+FrameCapture::FrameCapture(std::string directory, Format format,
+                           unsigned int width, unsigned int height,
+                           unsigned int fps)
+    : m_Directory(std::move(directory)),
+      m_Format(format),
+      m_Width(width),
+      m_Height(height),
+      m_Fps(fps) {
+    std::error_code error;
+    std::filesystem::create_directories(m_Directory, error);
+    if (error) {
+        LOG_ERROR("Can't create capture directory '{}': {}", m_Directory,
+                  error.message());
+    }
+
+    const auto size = static_cast<GLsizeiptr>(m_Width) * m_Height * 4;
+    glGenBuffers(static_cast<GLsizei>(m_PackBuffers.size()),
+                 m_PackBuffers.data());
+    for (const auto buffer : m_PackBuffers) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    m_Worker = std::thread(&FrameCapture::Work, this);
+    LOG_INFO("Capturing {}x{} frames into '{}'", m_Width, m_Height,
+             m_Directory);
+}
+
+FrameCapture::~FrameCapture() {
+    // Frames still in flight, oldest first
+    for (size_t i = 1; i <= RING_SIZE; ++i) {
+        const size_t slot = (m_NextFrame + i) % RING_SIZE;
+        if (m_Fences[slot] != nullptr) {
+            Collect(slot);
+        }
+    }
+    glDeleteBuffers(static_cast<GLsizei>(m_PackBuffers.size()),
+                    m_PackBuffers.data());
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_one();
+    m_Worker.join();
+
+    const auto stats = GetStats();
+    LOG_INFO("Capture stopped: {} frames written, {} dropped, {:.3f} ms per "
+             "frame on the main thread",
+             stats.written, stats.dropped, stats.averageCaptureMs);
+}
+
+void FrameCapture::Capture() {
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+    const size_t slot = m_NextFrame % RING_SIZE;
+    GLState::BindFramebuffer(0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_PackBuffers[slot]);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    // Returns right away, the copy lands in the buffer when the GPU gets to it
+    glReadPixels(0, 0, static_cast<GLsizei>(m_Width),
+                 static_cast<GLsizei>(m_Height), GL_RGBA, GL_UNSIGNED_BYTE,
+                 nullptr);
+    m_Fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_FrameIndices[slot] = m_NextFrame;
+    ++m_NextFrame;
+
+    // The slot written next is the one filled `READBACK_LATENCY` frames ago
+    const size_t oldest = m_NextFrame % RING_SIZE;
+    if (m_Fences[oldest] != nullptr) {
+        Collect(oldest);
+    }
+    // Unbound, or later `glGetTexImage` calls would write into the buffer
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    m_CaptureTicks += SDL_GetPerformanceCounter() - start;
+}
+
+FrameCapture::Stats FrameCapture::GetStats() const {
+    Stats stats;
+    stats.captured = m_Captured;
+    stats.written = m_Written;
+    stats.dropped = m_Dropped;
+    if (m_NextFrame > 0) {
+        stats.averageCaptureMs =
+            static_cast<float>(static_cast<double>(m_CaptureTicks) * 1000.0 /
+                               static_cast<double>(SDL_GetPerformanceFrequency()) /
+                               m_NextFrame);
+    }
+    return stats;
+}
+
+void FrameCapture::Collect(size_t slot) {
+    if (glClientWaitSync(m_Fences[slot], GL_SYNC_FLUSH_COMMANDS_BIT,
+                         FENCE_TIMEOUT_NS) == GL_TIMEOUT_EXPIRED) {
+        LOG_WARN("Frame {} readback timed out", m_FrameIndices[slot]);
+    }
+    glDeleteSync(m_Fences[slot]);
+    m_Fences[slot] = nullptr;
+    ++m_Captured;
+
+    Frame frame{m_FrameIndices[slot], {}};
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Queue.size() >= MAX_QUEUED_FRAMES) {
+            ++m_Dropped;
+            return;
+        }
+        if (!m_FreeBuffers.empty()) {
+            frame.pixels = std::move(m_FreeBuffers.back());
+            m_FreeBuffers.pop_back();
+        }
+    }
+
+    const size_t size = static_cast<size_t>(m_Width) * m_Height * 4;
+    frame.pixels.resize(size);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_PackBuffers[slot]);
+    const void *mapped = glMapBufferRange(
+        GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(size),
+        GL_MAP_READ_BIT);
+    if (mapped == nullptr) {
+        LOG_ERROR("Failed to map the readback of frame {}", frame.index);
+        ++m_Dropped;
+        return;
+    }
+    std::memcpy(frame.pixels.data(), mapped, size);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+    Push(std::move(frame));
+}
+
+void FrameCapture::Push(Frame frame) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Queue.push_back(std::move(frame));
+    }
+    m_Condition.notify_one();
+}
+
+void FrameCapture::Work() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true) {
+        m_Condition.wait(lock,
+                         [this] { return m_Stopping || !m_Queue.empty(); });
+        if (m_Queue.empty()) {
+            break;
+        }
+
+        Frame frame = std::move(m_Queue.front());
+        m_Queue.pop_front();
+
+        lock.unlock();
+        Encode(frame);
+        ++m_Written;
+        lock.lock();
+
+        m_FreeBuffers.push_back(std::move(frame.pixels));
+    }
+}
+
+void FrameCapture::Encode(Frame &frame) {
+    // OpenGL rows start at the bottom, both formats start at the top
+    const size_t pitch = static_cast<size_t>(m_Width) * 4;
+    for (size_t top = 0, bottom = m_Height - 1; top < bottom; ++top, --bottom) {
+        std::swap_ranges(frame.pixels.begin() + top * pitch,
+                         frame.pixels.begin() + (top + 1) * pitch,
+                         frame.pixels.begin() + bottom * pitch);
+    }
+
+    switch (m_Format) {
+    case Format::PNG:
+        WritePng(frame);
+        break;
+    case Format::Y4M:
+        WriteY4m(frame);
+        break;
+    }
+}
+
+void FrameCapture::WritePng(const Frame &frame) {
+    // `SDL_CreateRGBSurfaceWithFormatFrom` only borrows the pixels
+    auto *pixels = const_cast<Uint8 *>(frame.pixels.data());
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormatFrom(
+        pixels, static_cast<int>(m_Width), static_cast<int>(m_Height), 32,
+        static_cast<int>(m_Width * 4), SDL_PIXELFORMAT_RGBA32);
+    if (surface == nullptr) {
+        LOG_ERROR("Failed to wrap frame {}: {}", frame.index, SDL_GetError());
+        return;
+    }
+
+    const auto path =
+        fmt::format("{}/frame_{:06d}.png", m_Directory, frame.index);
+    if (IMG_SavePNG(surface, path.c_str()) != 0) {
+        LOG_ERROR("Failed to write '{}': {}", path, IMG_GetError());
+    }
+    SDL_FreeSurface(surface);
+}
+
+void FrameCapture::WriteY4m(const Frame &frame) {
+    if (!m_Stream.is_open()) {
+        const auto path = m_Directory + "/capture.y4m";
+        m_Stream.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_Stream) {
+            LOG_ERROR("Failed to open '{}'", path);
+            return;
+        }
+        m_Stream << fmt::format("YUV4MPEG2 W{} H{} F{}:1 Ip A1:1 C444\n",
+                                m_Width, m_Height, m_Fps);
+    }
+
+    // BT.601 limited range, what players assume when nothing else is said
+    const size_t count = static_cast<size_t>(m_Width) * m_Height;
+    m_Planes.resize(count * 3);
+    Uint8 *y = m_Planes.data();
+    Uint8 *u = y + count;
+    Uint8 *v = u + count;
+    for (size_t i = 0; i < count; ++i) {
+        const int r = frame.pixels[i * 4 + 0];
+        const int g = frame.pixels[i * 4 + 1];
+        const int b = frame.pixels[i * 4 + 2];
+        y[i] = static_cast<Uint8>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+        u[i] = static_cast<Uint8>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+        v[i] = static_cast<Uint8>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+    }
+
+    m_Stream << "FRAME\n";
+    m_Stream.write(reinterpret_cast<const char *>(m_Planes.data()),
+                   static_cast<std::streamsize>(m_Planes.size()));
+    if (!m_Stream) {
+        LOG_ERROR("Failed to write frame {}", frame.index);
+    }
+}
+} // namespace Core
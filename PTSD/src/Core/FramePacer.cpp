@@ -0,0 +1,123 @@
+#include "Core/FramePacer.hpp"
+
+#include <algorithm>
+
+#include "Util/Logger.hpp"
+
+namespace Core {
+FramePacer::FramePacer(unsigned int fpsCap)
+    : m_Frequency(SDL_GetPerformanceFrequency()),
+      m_Period(fpsCap != 0 ? m_Frequency / fpsCap : 0) {}
+
+VSyncMode FramePacer::SetVSync(VSyncMode mode) {
+    switch (mode) {
+    case VSyncMode::OFF:
+        SDL_GL_SetSwapInterval(0);
+        return mode;
+    case VSyncMode::ADAPTIVE:
+        if (SDL_GL_SetSwapInterval(-1) == 0) {
+            return mode;
+        }
+        LOG_INFO("Adaptive vsync unsupported, using vsync");
+        [[fallthrough]];
+    case VSyncMode::ON:
+        if (SDL_GL_SetSwapInterval(1) != 0) {
+            LOG_WARN("Failed to turn on vsync: {}", SDL_GetError());
+            return VSyncMode::OFF;
+        }
+        return VSyncMode::ON;
+    }
+    return VSyncMode::OFF;
+}
+
+void FramePacer::Latch() {
+    m_LatchTicks = SDL_GetPerformanceCounter();
+}
+
+void FramePacer::Presented() {
+    if (m_LatchTicks == 0) {
+        return;
+    }
+    const float latency = ToMs(SDL_GetPerformanceCounter() - m_LatchTicks);
+    m_InputLatencyMs += latency;
+    m_MaxInputLatencyMs = std::max(m_MaxInputLatencyMs, latency);
+    ++m_InputSamples;
+}
+
+void FramePacer::Wait() {
+    if (m_Period != 0) {
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (m_Deadline == 0) {
+            m_Deadline = now + m_Period;
+        }
+
+        if (now < m_Deadline) {
+            const float remaining = ToMs(m_Deadline - now);
+            if (remaining > SPIN_MS) {
+                SDL_Delay(static_cast<Uint32>(remaining - SPIN_MS));
+            }
+            while (SDL_GetPerformanceCounter() < m_Deadline) {
+            }
+        }
+
+        m_Deadline += m_Period;
+        now = SDL_GetPerformanceCounter();
+        // More than a frame behind, start over instead of rushing to catch up
+        if (now > m_Deadline) {
+            m_Deadline = now + m_Period;
+        }
+    }
+
+    const Uint64 now = SDL_GetPerformanceCounter();
+    if (m_LastFrame != 0) {
+        const auto bin = static_cast<std::size_t>(ToMs(now - m_LastFrame) / BIN_MS);
+        ++m_Histogram[std::min(bin, BIN_COUNT - 1)];
+        ++m_Frames;
+    }
+    m_LastFrame = now;
+}
+
+FramePacer::Stats FramePacer::GetStats() const {
+    Stats stats;
+    stats.frames = m_Frames;
+    if (m_InputSamples > 0) {
+        stats.averageInputLatencyMs =
+            static_cast<float>(m_InputLatencyMs / m_InputSamples);
+        stats.maxInputLatencyMs = m_MaxInputLatencyMs;
+    }
+    if (m_Frames == 0) {
+        return stats;
+    }
+
+    // Upper edge of the bin holding the percentile, off by at most `BIN_MS`
+    const auto percentile = [this](float fraction) {
+        const auto target =
+            static_cast<unsigned int>(fraction * static_cast<float>(m_Frames));
+        unsigned int count = 0;
+        for (std::size_t i = 0; i < BIN_COUNT; ++i) {
+            count += m_Histogram[i];
+            if (count > target) {
+                return static_cast<float>(i + 1) * BIN_MS;
+            }
+        }
+        return static_cast<float>(BIN_COUNT) * BIN_MS;
+    };
+    stats.p50Ms = percentile(0.5F);
+    stats.p99Ms = percentile(0.99F);
+    stats.jitterMs = stats.p99Ms - stats.p50Ms;
+    return stats;
+}
+
+void FramePacer::ResetStats() {
+    m_Histogram.fill(0);
+    m_Frames = 0;
+    m_InputLatencyMs = 0;
+    m_MaxInputLatencyMs = 0;
+    m_InputSamples = 0;
+}
+
+float FramePacer::ToMs(Uint64 ticks) const {
+    return static_cast<float>(static_cast<double>(ticks) * 1000.0 /
+                              static_cast<double>(m_Frequency));
+}
+} // namespace Core
@@ -0,0 +1,64 @@
+#include "Core/FrameUniforms.hpp"
+
+#include "Core/GLBackend.hpp"
+#include "Core/SpriteBatch.hpp"
+
+#include "Util/Logger.hpp"
+
+namespace Core {
+std::unique_ptr<UniformRing> FrameUniforms::s_ModelRing = nullptr;
+std::unique_ptr<UniformBuffer<glm::mat4>> FrameUniforms::s_CameraBuffer =
+    nullptr;
+glm::mat4 FrameUniforms::s_ViewProjection(0.F);
+
+void FrameUniforms::Attach(const Program &program) {
+    const GLuint modelIndex =
+        GL().GetUniformBlockIndex(program.GetId(), "Model");
+    const GLuint cameraIndex =
+        GL().GetUniformBlockIndex(program.GetId(), "Camera");
+
+    if (cameraIndex == GL_INVALID_INDEX) {
+        LOG_ERROR("Program {} is missing the Camera uniform block",
+                  program.GetId());
+        return;
+    }
+
+    if (modelIndex != GL_INVALID_INDEX) {
+        GL().UniformBlockBinding(program.GetId(), modelIndex, MODEL_BINDING);
+    }
+    GL().UniformBlockBinding(program.GetId(), cameraIndex, CAMERA_BINDING);
+}
+
+void FrameUniforms::Upload(const Matrices &data) {
+    SpriteBatch::Flush();
+
+    UploadCamera(data.m_Projection);
+    s_ModelRing->Push(data.m_Model);
+}
+
+void FrameUniforms::UploadCamera(const glm::mat4 &viewProjection) {
+    if (s_ModelRing == nullptr) {
+        Init();
+    }
+
+    if (viewProjection != s_ViewProjection) {
+        s_ViewProjection = viewProjection;
+        s_CameraBuffer->SetData(0, s_ViewProjection);
+    }
+}
+
+void FrameUniforms::NewFrame() {
+    if (s_ModelRing != nullptr) {
+        s_ModelRing->NextFrame();
+    }
+}
+
+void FrameUniforms::Init() {
+    // 256 KiB per segment is ~1000 draws at the common 256 byte alignment
+    constexpr GLsizeiptr segmentSize = 256 * 1024;
+
+    s_ModelRing = std::make_unique<UniformRing>(MODEL_BINDING, segmentSize);
+    s_CameraBuffer =
+        std::make_unique<UniformBuffer<glm::mat4>>(CAMERA_BINDING);
+}
+} // namespace Core
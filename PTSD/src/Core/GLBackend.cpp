@@ -0,0 +1,509 @@
+#include "Core/GLBackend.hpp"
+
+#include <cstdint>
+
+namespace Core {
+namespace {
+GLBackend::Stats s_NullStats;
+GLuint s_NextName = 1;
+
+// Unsigned byte components per pixel, the only type PTSD uploads
+unsigned long long PixelBytes(GLenum format, GLsizei width, GLsizei height) {
+    unsigned long long channels = 4;
+    switch (format) {
+    case GL_RED:
+    case GL_ALPHA:
+        channels = 1;
+        break;
+    case GL_RG:
+        channels = 2;
+        break;
+    case GL_RGB:
+    case GL_BGR:
+        channels = 3;
+        break;
+    default:
+        break;
+    }
+    return channels * static_cast<unsigned long long>(width) *
+           static_cast<unsigned long long>(height);
+}
+
+void CountBind() {
+    s_NullStats.calls++;
+    s_NullStats.binds++;
+}
+
+void CountUpload(unsigned long long bytes) {
+    s_NullStats.calls++;
+    s_NullStats.uploads++;
+    s_NullStats.uploadedBytes += bytes;
+}
+
+void CountUniform() {
+    s_NullStats.calls++;
+    s_NullStats.uniforms++;
+}
+
+void CountDraw() {
+    s_NullStats.calls++;
+    s_NullStats.draws++;
+}
+
+void CountOther() {
+    s_NullStats.calls++;
+}
+
+void GenNames(GLsizei n, GLuint *names) {
+    CountOther();
+    for (GLsizei i = 0; i < n; ++i) {
+        names[i] = s_NextName++;
+    }
+}
+
+void GLAPIENTRY NullActiveTexture(GLenum) {
+    CountBind();
+}
+void GLAPIENTRY NullBindTexture(GLenum, GLuint) {
+    CountBind();
+}
+void GLAPIENTRY NullBindBuffer(GLenum, GLuint) {
+    CountBind();
+}
+void GLAPIENTRY NullBindBufferBase(GLenum, GLuint, GLuint) {
+    CountBind();
+}
+void GLAPIENTRY NullBindBufferRange(GLenum, GLuint, GLuint, GLintptr,
+                                    GLsizeiptr) {
+    CountBind();
+}
+void GLAPIENTRY NullBindVertexArray(GLuint) {
+    CountBind();
+}
+void GLAPIENTRY NullBindFramebuffer(GLenum, GLuint) {
+    CountBind();
+}
+void GLAPIENTRY NullUseProgram(GLuint) {
+    CountBind();
+}
+
+void GLAPIENTRY NullEnable(GLenum) {
+    CountOther();
+}
+void GLAPIENTRY NullDisable(GLenum) {
+    CountOther();
+}
+void GLAPIENTRY NullBlendFunc(GLenum, GLenum) {
+    CountOther();
+}
+void GLAPIENTRY NullDepthMask(GLboolean) {
+    CountOther();
+}
+void GLAPIENTRY NullPixelStorei(GLenum, GLint) {
+    CountOther();
+}
+void GLAPIENTRY NullTexParameteri(GLenum, GLenum, GLint) {
+    CountOther();
+}
+
+void GLAPIENTRY NullTexImage2D(GLenum, GLint, GLint, GLsizei width,
+                               GLsizei height, GLint, GLenum format, GLenum,
+                               const void *pixels) {
+    CountUpload(pixels != nullptr ? PixelBytes(format, width, height) : 0);
+}
+void GLAPIENTRY NullTexSubImage2D(GLenum, GLint, GLint, GLint, GLsizei width,
+                                  GLsizei height, GLenum format, GLenum,
+                                  const void *) {
+    CountUpload(PixelBytes(format, width, height));
+}
+void GLAPIENTRY NullGenerateMipmap(GLenum) {
+    CountOther();
+}
+void GLAPIENTRY NullBufferData(GLenum, GLsizeiptr size, const void *data,
+                               GLenum) {
+    CountUpload(data != nullptr ? static_cast<unsigned long long>(size) : 0);
+}
+void GLAPIENTRY NullBufferSubData(GLenum, GLintptr, GLsizeiptr size,
+                                  const void *) {
+    CountUpload(static_cast<unsigned long long>(size));
+}
+void GLAPIENTRY NullBufferStorage(GLenum, GLsizeiptr size, const void *data,
+                                  GLbitfield) {
+    CountUpload(data != nullptr ? static_cast<unsigned long long>(size) : 0);
+}
+void *GLAPIENTRY NullMapBufferRange(GLenum, GLintptr, GLsizeiptr,
+                                    GLbitfield) {
+    CountOther();
+    return nullptr;
+}
+GLboolean GLAPIENTRY NullUnmapBuffer(GLenum) {
+    CountOther();
+    return GL_TRUE;
+}
+
+void GLAPIENTRY NullUniform1i(GLint, GLint) {
+    CountUniform();
+}
+void GLAPIENTRY NullUniform1f(GLint, GLfloat) {
+    CountUniform();
+}
+void GLAPIENTRY NullUniform2f(GLint, GLfloat, GLfloat) {
+    CountUniform();
+}
+void GLAPIENTRY NullUniform4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat) {
+    CountUniform();
+}
+void GLAPIENTRY NullUniformBlockBinding(GLuint, GLuint, GLuint) {
+    CountOther();
+}
+
+void GLAPIENTRY NullDrawElements(GLenum, GLsizei, GLenum, const void *) {
+    CountDraw();
+}
+void GLAPIENTRY NullDrawElementsInstanced(GLenum, GLsizei, GLenum,
+                                          const void *, GLsizei) {
+    CountDraw();
+}
+
+void GLAPIENTRY NullGenTextures(GLsizei n, GLuint *textures) {
+    GenNames(n, textures);
+}
+void GLAPIENTRY NullDeleteTextures(GLsizei, const GLuint *) {
+    CountOther();
+}
+void GLAPIENTRY NullGenBuffers(GLsizei n, GLuint *buffers) {
+    GenNames(n, buffers);
+}
+void GLAPIENTRY NullDeleteBuffers(GLsizei, const GLuint *) {
+    CountOther();
+}
+void GLAPIENTRY NullGenVertexArrays(GLsizei n, GLuint *arrays) {
+    GenNames(n, arrays);
+}
+void GLAPIENTRY NullDeleteVertexArrays(GLsizei, const GLuint *) {
+    CountOther();
+}
+void GLAPIENTRY NullEnableVertexAttribArray(GLuint) {
+    CountOther();
+}
+void GLAPIENTRY NullVertexAttribPointer(GLuint, GLint, GLenum, GLboolean,
+                                        GLsizei, const void *) {
+    CountOther();
+}
+void GLAPIENTRY NullVertexAttribDivisor(GLuint, GLuint) {
+    CountOther();
+}
+
+GLuint GLAPIENTRY NullCreateShader(GLenum) {
+    CountOther();
+    return s_NextName++;
+}
+void GLAPIENTRY NullDeleteShader(GLuint) {
+    CountOther();
+}
+void GLAPIENTRY NullShaderSource(GLuint, GLsizei, const GLchar *const *,
+                                 const GLint *) {
+    CountOther();
+}
+void GLAPIENTRY NullCompileShader(GLuint) {
+    CountOther();
+}
+void GLAPIENTRY NullGetShaderiv(GLuint, GLenum pname, GLint *params) {
+    CountOther();
+    *params = pname == GL_COMPILE_STATUS ? GL_TRUE : 0;
+}
+void GLAPIENTRY NullGetShaderInfoLog(GLuint, GLsizei bufSize, GLsizei *length,
+                                     GLchar *infoLog) {
+    CountOther();
+    if (length != nullptr) {
+        *length = 0;
+    }
+    if (bufSize > 0) {
+        infoLog[0] = '\0';
+    }
+}
+GLuint GLAPIENTRY NullCreateProgram() {
+    CountOther();
+    return s_NextName++;
+}
+void GLAPIENTRY NullDeleteProgram(GLuint) {
+    CountOther();
+}
+void GLAPIENTRY NullAttachShader(GLuint, GLuint) {
+    CountOther();
+}
+void GLAPIENTRY NullDetachShader(GLuint, GLuint) {
+    CountOther();
+}
+void GLAPIENTRY NullLinkProgram(GLuint) {
+    CountOther();
+}
+void GLAPIENTRY NullValidateProgram(GLuint) {
+    CountOther();
+}
+void GLAPIENTRY NullProgramParameteri(GLuint, GLenum, GLint) {
+    CountOther();
+}
+void GLAPIENTRY NullProgramBinary(GLuint, GLenum, const void *, GLsizei) {
+    CountOther();
+}
+void GLAPIENTRY NullGetProgramBinary(GLuint, GLsizei, GLsizei *length,
+                                     GLenum *, void *) {
+    CountOther();
+    if (length != nullptr) {
+        *length = 0;
+    }
+}
+void GLAPIENTRY NullGetProgramiv(GLuint, GLenum pname, GLint *params) {
+    CountOther();
+    *params = pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS ? GL_TRUE
+                                                                     : 0;
+}
+void GLAPIENTRY NullGetProgramInfoLog(GLuint, GLsizei bufSize,
+                                      GLsizei *length, GLchar *infoLog) {
+    NullGetShaderInfoLog(0, bufSize, length, infoLog);
+}
+GLint GLAPIENTRY NullGetUniformLocation(GLuint, const GLchar *) {
+    CountOther();
+    return 0;
+}
+GLuint GLAPIENTRY NullGetUniformBlockIndex(GLuint, const GLchar *) {
+    CountOther();
+    return 0;
+}
+
+void GLAPIENTRY NullGetIntegerv(GLenum pname, GLint *data) {
+    CountOther();
+    switch (pname) {
+    case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+    case GL_MAX_TEXTURE_IMAGE_UNITS:
+        *data = 16;
+        break;
+    case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+        *data = 256;
+        break;
+    default:
+        // Includes `GL_NUM_PROGRAM_BINARY_FORMATS`, so nothing is cached
+        *data = 0;
+        break;
+    }
+}
+const GLubyte *GLAPIENTRY NullGetString(GLenum) {
+    CountOther();
+    return reinterpret_cast<const GLubyte *>("PTSD null driver");
+}
+GLsync GLAPIENTRY NullFenceSync(GLenum, GLbitfield) {
+    CountOther();
+    return reinterpret_cast<GLsync>(static_cast<std::uintptr_t>(s_NextName++));
+}
+void GLAPIENTRY NullDeleteSync(GLsync) {
+    CountOther();
+}
+GLenum GLAPIENTRY NullClientWaitSync(GLsync, GLbitfield, GLuint64) {
+    CountOther();
+    return GL_ALREADY_SIGNALED;
+}
+void GLAPIENTRY NullGenQueries(GLsizei n, GLuint *ids) {
+    GenNames(n, ids);
+}
+void GLAPIENTRY NullDeleteQueries(GLsizei, const GLuint *) {
+    CountOther();
+}
+void GLAPIENTRY NullBeginQuery(GLenum, GLuint) {
+    CountOther();
+}
+void GLAPIENTRY NullEndQuery(GLenum) {
+    CountOther();
+}
+void GLAPIENTRY NullGetQueryObjectuiv(GLuint, GLenum pname, GLuint *params) {
+    CountOther();
+    *params = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+}
+void GLAPIENTRY NullGetQueryObjectui64v(GLuint, GLenum pname,
+                                        GLuint64 *params) {
+    CountOther();
+    *params = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+}
+
+const GLFunctions s_Null = {
+    NullActiveTexture,
+    NullBindTexture,
+    NullBindBuffer,
+    NullBindBufferBase,
+    NullBindBufferRange,
+    NullBindVertexArray,
+    NullBindFramebuffer,
+    NullUseProgram,
+
+    NullEnable,
+    NullDisable,
+    NullBlendFunc,
+    NullDepthMask,
+    NullPixelStorei,
+    NullTexParameteri,
+
+    NullTexImage2D,
+    NullTexSubImage2D,
+    NullGenerateMipmap,
+    NullBufferData,
+    NullBufferSubData,
+    NullBufferStorage,
+    NullMapBufferRange,
+    NullUnmapBuffer,
+
+    NullUniform1i,
+    NullUniform1f,
+    NullUniform2f,
+    NullUniform4f,
+    NullUniformBlockBinding,
+
+    NullDrawElements,
+    NullDrawElementsInstanced,
+
+    NullGenTextures,
+    NullDeleteTextures,
+    NullGenBuffers,
+    NullDeleteBuffers,
+    NullGenVertexArrays,
+    NullDeleteVertexArrays,
+    NullEnableVertexAttribArray,
+    NullVertexAttribPointer,
+    NullVertexAttribDivisor,
+
+    NullCreateShader,
+    NullDeleteShader,
+    NullShaderSource,
+    NullCompileShader,
+    NullGetShaderiv,
+    NullGetShaderInfoLog,
+    NullCreateProgram,
+    NullDeleteProgram,
+    NullAttachShader,
+    NullDetachShader,
+    NullLinkProgram,
+    NullValidateProgram,
+    NullProgramParameteri,
+    NullProgramBinary,
+    NullGetProgramBinary,
+    NullGetProgramiv,
+    NullGetProgramInfoLog,
+    NullGetUniformLocation,
+    NullGetUniformBlockIndex,
+
+    NullGetIntegerv,
+    NullGetString,
+    NullFenceSync,
+    NullDeleteSync,
+    NullClientWaitSync,
+    NullGenQueries,
+    NullDeleteQueries,
+    NullBeginQuery,
+    NullEndQuery,
+    NullGetQueryObjectuiv,
+    NullGetQueryObjectui64v,
+};
+
+// Filled by `GLBackend::Use()`, GLEW only has the entry points after
+// `glewInit()`
+GLFunctions s_Native = {};
+
+void LoadNative() {
+    s_Native.ActiveTexture = glActiveTexture;
+    s_Native.BindTexture = glBindTexture;
+    s_Native.BindBuffer = glBindBuffer;
+    s_Native.BindBufferBase = glBindBufferBase;
+    s_Native.BindBufferRange = glBindBufferRange;
+    s_Native.BindVertexArray = glBindVertexArray;
+    s_Native.BindFramebuffer = glBindFramebuffer;
+    s_Native.UseProgram = glUseProgram;
+
+    s_Native.Enable = glEnable;
+    s_Native.Disable = glDisable;
+    s_Native.BlendFunc = glBlendFunc;
+    s_Native.DepthMask = glDepthMask;
+    s_Native.PixelStorei = glPixelStorei;
+    s_Native.TexParameteri = glTexParameteri;
+
+    s_Native.TexImage2D = glTexImage2D;
+    s_Native.TexSubImage2D = glTexSubImage2D;
+    s_Native.GenerateMipmap = glGenerateMipmap;
+    s_Native.BufferData = glBufferData;
+    s_Native.BufferSubData = glBufferSubData;
+    s_Native.BufferStorage = glBufferStorage;
+    s_Native.MapBufferRange = glMapBufferRange;
+    s_Native.UnmapBuffer = glUnmapBuffer;
+
+    s_Native.Uniform1i = glUniform1i;
+    s_Native.Uniform1f = glUniform1f;
+    s_Native.Uniform2f = glUniform2f;
+    s_Native.Uniform4f = glUniform4f;
+    s_Native.UniformBlockBinding = glUniformBlockBinding;
+
+    s_Native.DrawElements = glDrawElements;
+    s_Native.DrawElementsInstanced = glDrawElementsInstanced;
+
+    s_Native.GenTextures = glGenTextures;
+    s_Native.DeleteTextures = glDeleteTextures;
+    s_Native.GenBuffers = glGenBuffers;
+    s_Native.DeleteBuffers = glDeleteBuffers;
+    s_Native.GenVertexArrays = glGenVertexArrays;
+    s_Native.DeleteVertexArrays = glDeleteVertexArrays;
+    s_Native.EnableVertexAttribArray = glEnableVertexAttribArray;
+    s_Native.VertexAttribPointer = glVertexAttribPointer;
+    s_Native.VertexAttribDivisor = glVertexAttribDivisor;
+
+    s_Native.CreateShader = glCreateShader;
+    s_Native.DeleteShader = glDeleteShader;
+    s_Native.ShaderSource = glShaderSource;
+    s_Native.CompileShader = glCompileShader;
+    s_Native.GetShaderiv = glGetShaderiv;
+    s_Native.GetShaderInfoLog = glGetShaderInfoLog;
+    s_Native.CreateProgram = glCreateProgram;
+    s_Native.DeleteProgram = glDeleteProgram;
+    s_Native.AttachShader = glAttachShader;
+    s_Native.DetachShader = glDetachShader;
+    s_Native.LinkProgram = glLinkProgram;
+    s_Native.ValidateProgram = glValidateProgram;
+    s_Native.ProgramParameteri = glProgramParameteri;
+    s_Native.ProgramBinary = glProgramBinary;
+    s_Native.GetProgramBinary = glGetProgramBinary;
+    s_Native.GetProgramiv = glGetProgramiv;
+    s_Native.GetProgramInfoLog = glGetProgramInfoLog;
+    s_Native.GetUniformLocation = glGetUniformLocation;
+    s_Native.GetUniformBlockIndex = glGetUniformBlockIndex;
+
+    s_Native.GetIntegerv = glGetIntegerv;
+    s_Native.GetString = glGetString;
+    s_Native.FenceSync = glFenceSync;
+    s_Native.DeleteSync = glDeleteSync;
+    s_Native.ClientWaitSync = glClientWaitSync;
+    s_Native.GenQueries = glGenQueries;
+    s_Native.DeleteQueries = glDeleteQueries;
+    s_Native.BeginQuery = glBeginQuery;
+    s_Native.EndQuery = glEndQuery;
+    s_Native.GetQueryObjectuiv = glGetQueryObjectuiv;
+    s_Native.GetQueryObjectui64v = glGetQueryObjectui64v;
+}
+} // namespace
+
+GLBackendType GLBackend::s_Type = GLBackendType::NATIVE;
+const GLFunctions *GLBackend::s_Functions = &s_Native;
+
+void GLBackend::Use(GLBackendType type) {
+    s_Type = type;
+    if (type == GLBackendType::NATIVE) {
+        LoadNative();
+        s_Functions = &s_Native;
+    } else {
+        s_Functions = &s_Null;
+    }
+}
+
+const GLBackend::Stats &GLBackend::GetStats() {
+    return s_NullStats;
+}
+
+void GLBackend::ResetStats() {
+    s_NullStats = Stats();
+}
+} // namespace Core
@@ -0,0 +1,221 @@
+#include "Core/GLState.hpp"
+
+#include "Core/GLBackend.hpp"
+
+namespace Core {
+GLuint GLState::s_Program = GLState::UNKNOWN;
+GLuint GLState::s_VertexArray = GLState::UNKNOWN;
+GLuint GLState::s_ActiveUnit = GLState::UNKNOWN;
+std::array<GLuint, GLState::MAX_TRACKED_UNITS> GLState::s_Textures = [] {
+    std::array<GLuint, MAX_TRACKED_UNITS> textures{};
+    textures.fill(UNKNOWN);
+    return textures;
+}();
+GLuint GLState::s_UniformBuffer = GLState::UNKNOWN;
+GLuint GLState::s_Framebuffer = GLState::UNKNOWN;
+std::array<GLuint, GLState::MAX_TRACKED_UBO_BINDINGS>
+    GLState::s_UniformBindings = [] {
+        std::array<GLuint, MAX_TRACKED_UBO_BINDINGS> bindings{};
+        bindings.fill(UNKNOWN);
+        return bindings;
+    }();
+
+GLuint GLState::s_Blend = GLState::UNKNOWN;
+GLuint GLState::s_BlendSrc = GLState::UNKNOWN;
+GLuint GLState::s_BlendDst = GLState::UNKNOWN;
+GLuint GLState::s_DepthTest = GLState::UNKNOWN;
+GLuint GLState::s_DepthMask = GLState::UNKNOWN;
+
+GLint GLState::s_MaxTextureUnits = 0;
+ValidationTier GLState::s_Tier = ValidationTier::NONE;
+
+GLState::Stats GLState::s_Current;
+GLState::Stats GLState::s_LastFrame;
+
+bool GLState::Changed(GLuint &cached, GLuint value) {
+    if (cached == value) {
+        s_Current.redundantStateChanges++;
+        return false;
+    }
+    cached = value;
+    s_Current.stateChanges++;
+    return true;
+}
+
+void GLState::UseProgram(GLuint program) {
+    if (Changed(s_Program, program)) {
+        GL().UseProgram(program);
+    }
+}
+
+void GLState::BindVertexArray(GLuint vertexArray) {
+    if (Changed(s_VertexArray, vertexArray)) {
+        GL().BindVertexArray(vertexArray);
+    }
+}
+
+void GLState::BindTexture(GLuint unit, GLuint texture) {
+    if (unit >= MAX_TRACKED_UNITS) {
+        s_ActiveUnit = unit;
+        s_Current.stateChanges += 2;
+        GL().ActiveTexture(GL_TEXTURE0 + unit);
+        GL().BindTexture(GL_TEXTURE_2D, texture);
+        return;
+    }
+
+    if (s_Textures[unit] == texture) {
+        s_Current.redundantStateChanges++;
+        return;
+    }
+    if (Changed(s_ActiveUnit, unit)) {
+        GL().ActiveTexture(GL_TEXTURE0 + unit);
+    }
+    s_Textures[unit] = texture;
+    s_Current.stateChanges++;
+    GL().BindTexture(GL_TEXTURE_2D, texture);
+}
+
+void GLState::BindUniformBuffer(GLuint buffer) {
+    if (Changed(s_UniformBuffer, buffer)) {
+        GL().BindBuffer(GL_UNIFORM_BUFFER, buffer);
+    }
+}
+
+void GLState::BindUniformBufferBase(GLuint binding, GLuint buffer) {
+    if (binding < MAX_TRACKED_UBO_BINDINGS &&
+        s_UniformBindings[binding] == buffer) {
+        s_Current.redundantStateChanges++;
+        return;
+    }
+    if (binding < MAX_TRACKED_UBO_BINDINGS) {
+        s_UniformBindings[binding] = buffer;
+    }
+    // `glBindBufferBase()` also replaces the generic binding point
+    s_UniformBuffer = buffer;
+    s_Current.stateChanges++;
+    GL().BindBufferBase(GL_UNIFORM_BUFFER, binding, buffer);
+}
+
+void GLState::BindUniformBufferRange(GLuint binding, GLuint buffer,
+                                     GLintptr offset, GLsizeiptr size) {
+    if (binding < MAX_TRACKED_UBO_BINDINGS) {
+        // A later `glBindBufferBase()` of the same buffer is not a no-op
+        s_UniformBindings[binding] = UNKNOWN;
+    }
+    s_UniformBuffer = buffer;
+    s_Current.stateChanges++;
+    GL().BindBufferRange(GL_UNIFORM_BUFFER, binding, buffer, offset, size);
+}
+
+void GLState::BindFramebuffer(GLuint framebuffer) {
+    if (Changed(s_Framebuffer, framebuffer)) {
+        GL().BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    }
+}
+
+void GLState::SetBlend(bool enabled) {
+    if (Changed(s_Blend, enabled ? GL_TRUE : GL_FALSE)) {
+        enabled ? GL().Enable(GL_BLEND) : GL().Disable(GL_BLEND);
+    }
+}
+
+void GLState::SetBlendFunc(GLenum src, GLenum dst) {
+    if (s_BlendSrc == src && s_BlendDst == dst) {
+        s_Current.redundantStateChanges++;
+        return;
+    }
+    s_BlendSrc = src;
+    s_BlendDst = dst;
+    s_Current.stateChanges++;
+    GL().BlendFunc(src, dst);
+}
+
+void GLState::SetDepthTest(bool enabled) {
+    if (Changed(s_DepthTest, enabled ? GL_TRUE : GL_FALSE)) {
+        enabled ? GL().Enable(GL_DEPTH_TEST) : GL().Disable(GL_DEPTH_TEST);
+    }
+}
+
+void GLState::SetDepthMask(bool enabled) {
+    if (Changed(s_DepthMask, enabled ? GL_TRUE : GL_FALSE)) {
+        GL().DepthMask(enabled ? GL_TRUE : GL_FALSE);
+    }
+}
+
+void GLState::ForgetProgram(GLuint program) {
+    if (s_Program == program) {
+        s_Program = UNKNOWN;
+    }
+}
+
+void GLState::ForgetVertexArray(GLuint vertexArray) {
+    if (s_VertexArray == vertexArray) {
+        s_VertexArray = UNKNOWN;
+    }
+}
+
+void GLState::ForgetTexture(GLuint texture) {
+    for (auto &bound : s_Textures) {
+        if (bound == texture) {
+            bound = UNKNOWN;
+        }
+    }
+}
+
+void GLState::ForgetBuffer(GLuint buffer) {
+    if (s_UniformBuffer == buffer) {
+        s_UniformBuffer = UNKNOWN;
+    }
+    for (auto &bound : s_UniformBindings) {
+        if (bound == buffer) {
+            bound = UNKNOWN;
+        }
+    }
+}
+
+void GLState::Invalidate() {
+    s_Program = UNKNOWN;
+    s_VertexArray = UNKNOWN;
+    s_ActiveUnit = UNKNOWN;
+    s_Textures.fill(UNKNOWN);
+    s_UniformBuffer = UNKNOWN;
+    s_UniformBindings.fill(UNKNOWN);
+    s_Framebuffer = UNKNOWN;
+    s_Blend = UNKNOWN;
+    s_BlendSrc = UNKNOWN;
+    s_BlendDst = UNKNOWN;
+    s_DepthTest = UNKNOWN;
+    s_DepthMask = UNKNOWN;
+}
+
+GLint GLState::GetMaxTextureUnits() {
+    if (s_MaxTextureUnits == 0) {
+        GL().GetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS,
+                         &s_MaxTextureUnits);
+    }
+    return s_MaxTextureUnits;
+}
+
+void GLState::SetValidationTier(ValidationTier tier) {
+    s_Tier = tier;
+
+#ifndef __APPLE__
+    if (tier == ValidationTier::NONE) {
+        GL().Disable(GL_DEBUG_OUTPUT);
+    } else {
+        GL().Enable(GL_DEBUG_OUTPUT);
+    }
+
+    if (tier == ValidationTier::SYNCHRONOUS || tier == ValidationTier::FULL) {
+        GL().Enable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    } else {
+        GL().Disable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    }
+#endif
+}
+
+void GLState::NewFrame() {
+    s_LastFrame = s_Current;
+    s_Current = Stats();
+}
+} // namespace Core
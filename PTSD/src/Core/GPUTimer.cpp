@@ -0,0 +1,230 @@
+#include "Core/GPUTimer.hpp"
+
+#include <cstring>
+
+#include "Core/GLBackend.hpp"
+
+#include "Util/Logger.hpp"
+
+namespace Core {
+bool GPUTimer::s_Enabled = false;
+bool GPUTimer::s_Initialized = false;
+std::array<GPUTimer::Frame, GPUTimer::FRAMES_IN_FLIGHT> GPUTimer::s_Frames;
+std::size_t GPUTimer::s_Current = 0;
+std::size_t GPUTimer::s_Running = GPUTimer::MAX_PASSES;
+
+std::array<const char *, GPUTimer::MAX_PASSES> GPUTimer::s_Names = {};
+std::size_t GPUTimer::s_PassCount = 0;
+std::array<float, GPUTimer::MAX_PASSES> GPUTimer::s_LastMs = {};
+std::array<double, GPUTimer::MAX_PASSES> GPUTimer::s_TotalMs = {};
+GPUTimer::Stats GPUTimer::s_Stats;
+
+void GPUTimer::SetEnabled(bool enabled) {
+    if (!enabled) {
+        End();
+        s_Enabled = false;
+        return;
+    }
+    if (GL().GetQueryObjectui64v == nullptr) {
+        LOG_WARN("Timer queries unsupported, GPU pass timing stays off");
+        return;
+    }
+    if (!s_Initialized) {
+        for (auto &frame : s_Frames) {
+            GL().GenQueries(static_cast<GLsizei>(frame.queries.size()),
+                            frame.queries.data());
+        }
+        s_Initialized = true;
+    }
+    s_Enabled = true;
+}
+
+bool GPUTimer::IsEnabled() {
+    return s_Enabled;
+}
+
+void GPUTimer::Begin(const char *pass) {
+    if (!s_Enabled) {
+        return;
+    }
+    const std::size_t index = FindPass(pass);
+    if (index == s_Running) {
+        return;
+    }
+    End();
+
+    auto &frame = s_Frames[s_Current];
+    if (frame.count == frame.queries.size()) {
+        s_Stats.dropped++;
+        return;
+    }
+    GL().BeginQuery(GL_TIME_ELAPSED, frame.queries[frame.count]);
+    frame.passes[frame.count] = index;
+    frame.count++;
+    s_Running = index;
+}
+
+void GPUTimer::End() {
+    if (s_Running == MAX_PASSES) {
+        return;
+    }
+    GL().EndQuery(GL_TIME_ELAPSED);
+    s_Running = MAX_PASSES;
+}
+
+const char *GPUTimer::GetCurrentPass() {
+    return s_Running != MAX_PASSES ? s_Names[s_Running] : nullptr;
+}
+
+void GPUTimer::NewFrame() {
+    if (!s_Initialized) {
+        return;
+    }
+    End();
+    // The slot about to be reused holds the oldest frame still in flight
+    s_Current = (s_Current + 1) % FRAMES_IN_FLIGHT;
+    Collect(s_Frames[s_Current]);
+}
+
+std::size_t GPUTimer::GetPassCount() {
+    return s_PassCount;
+}
+
+const char *GPUTimer::GetPassName(std::size_t pass) {
+    return pass < s_PassCount ? s_Names[pass] : nullptr;
+}
+
+float GPUTimer::GetPassMs(std::size_t pass) {
+    return pass < s_PassCount ? s_LastMs[pass] : 0;
+}
+
+float GPUTimer::GetAverageMs(std::size_t pass) {
+    if (pass >= s_PassCount || s_Stats.frames == 0) {
+        return 0;
+    }
+    return static_cast<float>(s_TotalMs[pass] / s_Stats.frames);
+}
+
+const GPUTimer::Stats &GPUTimer::GetStats() {
+    return s_Stats;
+}
+
+void GPUTimer::ResetStats() {
+    s_TotalMs.fill(0);
+    s_Stats = Stats();
+}
+
+void GPUTimer::DrawWindow() {
+    if (!ImGui::Begin("GPU passes")) {
+        ImGui::End();
+        return;
+    }
+
+    bool enabled = IsEnabled();
+    if (ImGui::Checkbox("Enabled", &enabled)) {
+        SetEnabled(enabled);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Reset")) {
+        ResetStats();
+    }
+    ImGui::Text("%u frames, %u late, %u dropped", s_Stats.frames,
+                s_Stats.late, s_Stats.dropped);
+
+    constexpr ImGuiTableFlags flags =
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+        ImGuiTableFlags_SizingFixedFit;
+    if (ImGui::BeginTable("passes", 3, flags)) {
+        ImGui::TableSetupColumn("Pass");
+        ImGui::TableSetupColumn("Last ms");
+        ImGui::TableSetupColumn("Average ms");
+        ImGui::TableHeadersRow();
+
+        float last = 0;
+        float average = 0;
+        for (std::size_t i = 0; i < s_PassCount; ++i) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(s_Names[i]);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", GetPassMs(i));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", GetAverageMs(i));
+            last += GetPassMs(i);
+            average += GetAverageMs(i);
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted("Total");
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", last);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", average);
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+std::size_t GPUTimer::FindPass(const char *pass) {
+    for (std::size_t i = 0; i < s_PassCount; ++i) {
+        if (s_Names[i] == pass) {
+            return i;
+        }
+    }
+    for (std::size_t i = 0; i < s_PassCount; ++i) {
+        if (std::strcmp(s_Names[i], pass) == 0) {
+            return i;
+        }
+    }
+    if (s_PassCount == MAX_PASSES) {
+        return MAX_PASSES - 1;
+    }
+    s_Names[s_PassCount] = pass;
+    return s_PassCount++;
+}
+
+void GPUTimer::Collect(Frame &frame) {
+    if (frame.count == 0) {
+        return;
+    }
+
+    // Never wait on the GPU, a frame that isn't done yet is skipped
+    for (std::size_t i = 0; i < frame.count; ++i) {
+        GLuint available = GL_FALSE;
+        GL().GetQueryObjectuiv(frame.queries[i], GL_QUERY_RESULT_AVAILABLE,
+                               &available);
+        if (available == GL_FALSE) {
+            s_Stats.late++;
+            frame.count = 0;
+            return;
+        }
+    }
+
+    std::array<GLuint64, MAX_PASSES> elapsed = {};
+    for (std::size_t i = 0; i < frame.count; ++i) {
+        GLuint64 ns = 0;
+        GL().GetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &ns);
+        elapsed[frame.passes[i]] += ns;
+    }
+    for (std::size_t i = 0; i < s_PassCount; ++i) {
+        s_LastMs[i] = static_cast<float>(static_cast<double>(elapsed[i]) / 1e6);
+        s_TotalMs[i] += s_LastMs[i];
+    }
+    s_Stats.frames++;
+    frame.count = 0;
+}
+
+GPUTimerScope::GPUTimerScope(const char *pass)
+    : m_Previous(GPUTimer::GetCurrentPass()) {
+    GPUTimer::Begin(pass);
+}
+
+GPUTimerScope::~GPUTimerScope() {
+    if (m_Previous != nullptr) {
+        GPUTimer::Begin(m_Previous);
+    } else {
+        GPUTimer::End();
+    }
+}
+} // namespace Core
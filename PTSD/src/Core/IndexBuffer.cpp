@@ -1,13 +1,16 @@
 #include "Core/IndexBuffer.hpp"
 
+#include "Core/GLBackend.hpp"
+
 namespace Core {
 IndexBuffer::IndexBuffer(const std::vector<unsigned int> &indices)
-    : m_Count(indices.size()) {
-    glGenBuffers(1, &m_BufferId);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_BufferId);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                 static_cast<GLsizeiptr>(indices.size() * sizeof(GLuint)),
-                 indices.data(), GL_STATIC_DRAW);
+    : m_Count(indices.size()),
+      m_Capacity(indices.size()) {
+    GL().GenBuffers(1, &m_BufferId);
+    GL().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_BufferId);
+    GL().BufferData(GL_ELEMENT_ARRAY_BUFFER,
+                    static_cast<GLsizeiptr>(indices.size() * sizeof(GLuint)),
+                    indices.data(), GL_STATIC_DRAW);
 }
 
 IndexBuffer::IndexBuffer(IndexBuffer &&other) {
@@ -15,10 +18,11 @@ IndexBuffer::IndexBuffer(IndexBuffer &&other) {
     other.m_BufferId = 0;
 
     m_Count = std::move(other.m_Count);
+    m_Capacity = std::move(other.m_Capacity);
 }
 
 IndexBuffer::~IndexBuffer() {
-    glDeleteBuffers(1, &m_BufferId);
+    GL().DeleteBuffers(1, &m_BufferId);
 }
 
 IndexBuffer &IndexBuffer::operator=(IndexBuffer &&other) {
@@ -26,15 +30,30 @@ IndexBuffer &IndexBuffer::operator=(IndexBuffer &&other) {
     other.m_BufferId = 0;
 
     m_Count = std::move(other.m_Count);
+    m_Capacity = std::move(other.m_Capacity);
 
     return *this;
 }
 
 void IndexBuffer::Bind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_BufferId);
+    GL().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_BufferId);
 }
 
 void IndexBuffer::Unbind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    GL().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void IndexBuffer::SetData(const std::vector<unsigned int> &indices) {
+    const auto size = static_cast<GLsizeiptr>(indices.size() * sizeof(GLuint));
+
+    GL().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_BufferId);
+    if (indices.size() > m_Capacity) {
+        GL().BufferData(GL_ELEMENT_ARRAY_BUFFER, size, indices.data(),
+                        GL_DYNAMIC_DRAW);
+        m_Capacity = indices.size();
+    } else {
+        GL().BufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, size, indices.data());
+    }
+    m_Count = indices.size();
 }
 } // namespace Core
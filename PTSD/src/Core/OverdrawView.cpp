@@ -0,0 +1,149 @@
+#include "Core/OverdrawView.hpp"
+
+#include "Core/FrameUniforms.hpp"
+#include "Core/GLState.hpp"
+
+#include "Util/Logger.hpp"
+
+#include "config.hpp"
+
+namespace Core {
+bool OverdrawView::s_Enabled = false;
+float OverdrawView::s_LastAverage = 0;
+
+GLuint OverdrawView::s_Framebuffer = 0;
+GLuint OverdrawView::s_CountTexture = 0;
+GLuint OverdrawView::s_DepthBuffer = 0;
+GLint OverdrawView::s_TopLevel = 0;
+
+std::unique_ptr<Program> OverdrawView::s_CountProgram = nullptr;
+std::unique_ptr<Program> OverdrawView::s_HeatmapProgram = nullptr;
+std::unique_ptr<VertexArray> OverdrawView::s_Quad = nullptr;
+
+void OverdrawView::SetEnabled(bool enabled) {
+    if (enabled && s_Framebuffer == 0) {
+        Init();
+    }
+    if (enabled && !s_Enabled) {
+        // Counts left over from an earlier session would leak into this one
+        Clear();
+    }
+    s_Enabled = enabled;
+}
+
+void OverdrawView::Begin() {
+    GLState::BindFramebuffer(s_Framebuffer);
+    GLState::SetDepthTest(true);
+    GLState::SetBlend(true);
+    GLState::SetBlendFunc(GL_ONE, GL_ONE);
+
+    s_CountProgram->Bind();
+    s_CountProgram->Validate();
+}
+
+void OverdrawView::End() {
+    GLState::BindFramebuffer(0);
+    GLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void OverdrawView::Present() {
+    if (!s_Enabled) {
+        return;
+    }
+
+    GLState::BindTexture(UNIFORM_SURFACE_LOCATION, s_CountTexture);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    // Stalls until the frame is drawn, acceptable for a debug view
+    glGetTexImage(GL_TEXTURE_2D, s_TopLevel, GL_RED, GL_FLOAT, &s_LastAverage);
+
+    GLState::SetDepthTest(false);
+    GLState::SetBlend(false);
+
+    s_HeatmapProgram->Bind();
+    s_HeatmapProgram->Validate();
+    s_Quad->Bind();
+    s_Quad->DrawTriangles();
+
+    GLState::SetDepthTest(true);
+    GLState::SetBlend(true);
+
+    Clear();
+}
+
+void OverdrawView::Init() {
+    glGenTextures(1, &s_CountTexture);
+    GLState::BindTexture(UNIFORM_SURFACE_LOCATION, s_CountTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, WINDOW_WIDTH, WINDOW_HEIGHT, 0,
+                 GL_RED, GL_FLOAT, nullptr);
+    // The heatmap only samples the base level, the mipmaps are for averaging
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    s_TopLevel = static_cast<GLint>(
+        std::floor(std::log2(std::max(WINDOW_WIDTH, WINDOW_HEIGHT))));
+
+    glGenRenderbuffers(1, &s_DepthBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, s_DepthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, WINDOW_WIDTH,
+                          WINDOW_HEIGHT);
+
+    glGenFramebuffers(1, &s_Framebuffer);
+    GLState::BindFramebuffer(s_Framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                           s_CountTexture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                              GL_RENDERBUFFER, s_DepthBuffer);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        LOG_ERROR("Overdraw framebuffer is incomplete");
+    }
+    GLState::BindFramebuffer(0);
+
+    s_CountProgram = std::make_unique<Program>(
+        PTSD_ASSETS_DIR "/shaders/Sprite.vert",
+        PTSD_ASSETS_DIR "/shaders/OverdrawCount.frag");
+    FrameUniforms::Attach(*s_CountProgram);
+    s_CountProgram->Bind();
+    glUniform1i(glGetUniformLocation(s_CountProgram->GetId(), "surface"),
+                UNIFORM_SURFACE_LOCATION);
+
+    s_HeatmapProgram = std::make_unique<Program>(
+        PTSD_ASSETS_DIR "/shaders/OverdrawHeatmap.vert",
+        PTSD_ASSETS_DIR "/shaders/OverdrawHeatmap.frag");
+    s_HeatmapProgram->Bind();
+    glUniform1i(glGetUniformLocation(s_HeatmapProgram->GetId(), "counts"),
+                UNIFORM_SURFACE_LOCATION);
+
+    s_Quad = std::make_unique<VertexArray>();
+    s_Quad->AddVertexBuffer(std::make_unique<VertexBuffer>(
+        std::vector<float>{
+            -1.0F, 1.0F,  //
+            -1.0F, -1.0F, //
+            1.0F, -1.0F,  //
+            1.0F, 1.0F,   //
+        },
+        2));
+    s_Quad->AddVertexBuffer(std::make_unique<VertexBuffer>(
+        std::vector<float>{
+            0.0F, 1.0F, //
+            0.0F, 0.0F, //
+            1.0F, 0.0F, //
+            1.0F, 1.0F, //
+        },
+        2));
+    s_Quad->SetIndexBuffer(
+        std::make_unique<IndexBuffer>(std::vector<unsigned int>{
+            0, 1, 2, //
+            0, 2, 3, //
+        }));
+}
+
+void OverdrawView::Clear() {
+    constexpr GLfloat zero[] = {0, 0, 0, 0};
+    constexpr GLfloat farthest = 1;
+
+    GLState::BindFramebuffer(s_Framebuffer);
+    GLState::SetDepthMask(true);
+    glClearBufferfv(GL_COLOR, 0, zero);
+    glClearBufferfv(GL_DEPTH, 0, &farthest);
+    GLState::BindFramebuffer(0);
+}
+} // namespace Core
@@ -1,84 +1,125 @@
 #include "Core/Program.hpp"
 
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
+#include "Core/ProgramCache.hpp"
 #include "Core/Shader.hpp"
 
+#include "Util/LoadTextFile.hpp"
 #include "Util/Logger.hpp"
 
 namespace Core {
 Program::Program(const std::string &vertexShaderFilepath,
-                 const std::string &fragmentShaderFilepath) {
-    m_ProgramId = glCreateProgram();
+                 const std::string &fragmentShaderFilepath,
+                 const std::vector<std::string> &defines) {
+    m_ProgramId = GL().CreateProgram();
+
+    // The sources are read again by `Shader` on a miss, which only happens
+    // once per driver and source change
+    const std::string key = ProgramCache::MakeKey(
+        Shader::InjectDefines(Util::LoadTextFile(vertexShaderFilepath),
+                              defines),
+        Shader::InjectDefines(Util::LoadTextFile(fragmentShaderFilepath),
+                              defines));
+    if (ProgramCache::Load(m_ProgramId, key)) {
+        return;
+    }
+
+    Shader vertex(vertexShaderFilepath, Shader::Type::VERTEX, defines);
+    Shader fragment(fragmentShaderFilepath, Shader::Type::FRAGMENT, defines);
 
-    Shader vertex(vertexShaderFilepath, Shader::Type::VERTEX);
-    Shader fragment(fragmentShaderFilepath, Shader::Type::FRAGMENT);
+    GL().AttachShader(m_ProgramId, vertex.GetShaderId());
+    GL().AttachShader(m_ProgramId, fragment.GetShaderId());
 
-    glAttachShader(m_ProgramId, vertex.GetShaderId());
-    glAttachShader(m_ProgramId, fragment.GetShaderId());
+    GL().ProgramParameteri(m_ProgramId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                           GL_TRUE);
+    GL().LinkProgram(m_ProgramId);
 
-    glLinkProgram(m_ProgramId);
+    const bool linked = CheckStatus();
 
-    CheckStatus();
+    GL().DetachShader(m_ProgramId, vertex.GetShaderId());
+    GL().DetachShader(m_ProgramId, fragment.GetShaderId());
 
-    glDetachShader(m_ProgramId, vertex.GetShaderId());
-    glDetachShader(m_ProgramId, fragment.GetShaderId());
+    if (linked) {
+        ProgramCache::Store(m_ProgramId, key);
+    }
 }
 
-Program::Program(Program &&other) {
+Program::Program(Program &&other)
+    : m_UniformLocations(std::move(other.m_UniformLocations)) {
     m_ProgramId = other.m_ProgramId;
     other.m_ProgramId = 0;
 }
 
 Program::~Program() {
-    glDeleteProgram(m_ProgramId);
+    GLState::ForgetProgram(m_ProgramId);
+    GL().DeleteProgram(m_ProgramId);
 }
 
 Program &Program::operator=(Program &&other) {
     m_ProgramId = other.m_ProgramId;
     other.m_ProgramId = 0;
+    m_UniformLocations = std::move(other.m_UniformLocations);
 
     return *this;
 }
 
+GLint Program::GetUniformLocation(const std::string &name) const {
+    const auto it = m_UniformLocations.find(name);
+    if (it != m_UniformLocations.end()) {
+        return it->second;
+    }
+
+    const GLint location = GL().GetUniformLocation(m_ProgramId, name.c_str());
+    m_UniformLocations.emplace(name, location);
+    return location;
+}
+
 void Program::Bind() const {
-    glUseProgram(m_ProgramId);
+    GLState::UseProgram(m_ProgramId);
 }
 
 void Program::Unbind() const {
-    glUseProgram(0);
+    GLState::UseProgram(0);
 }
 
 void Program::Validate() const {
+    if (!GLState::ShouldValidatePrograms()) {
+        return;
+    }
+
     GLint status = GL_FALSE;
 
-    glValidateProgram(m_ProgramId);
-    glGetProgramiv(m_ProgramId, GL_VALIDATE_STATUS, &status);
+    GL().ValidateProgram(m_ProgramId);
+    GL().GetProgramiv(m_ProgramId, GL_VALIDATE_STATUS, &status);
     if (status != GL_TRUE) {
         int infoLogLength;
-        glGetProgramiv(m_ProgramId, GL_INFO_LOG_LENGTH, &infoLogLength);
+        GL().GetProgramiv(m_ProgramId, GL_INFO_LOG_LENGTH, &infoLogLength);
 
         std::vector<char> message(infoLogLength + 1);
-        glGetProgramInfoLog(m_ProgramId, infoLogLength, nullptr,
-                            message.data());
+        GL().GetProgramInfoLog(m_ProgramId, infoLogLength, nullptr,
+                               message.data());
 
         LOG_ERROR("Validation Failed:");
         LOG_ERROR("{}", message.data());
     }
 }
 
-void Program::CheckStatus() const {
+bool Program::CheckStatus() const {
     GLint status = GL_FALSE;
 
-    glGetProgramiv(m_ProgramId, GL_LINK_STATUS, &status);
+    GL().GetProgramiv(m_ProgramId, GL_LINK_STATUS, &status);
     if (status != GL_TRUE) {
         int infoLogLength;
-        glGetProgramiv(m_ProgramId, GL_INFO_LOG_LENGTH, &infoLogLength);
+        GL().GetProgramiv(m_ProgramId, GL_INFO_LOG_LENGTH, &infoLogLength);
 
         std::vector<char> message(infoLogLength + 1);
-        glGetProgramInfoLog(m_ProgramId, infoLogLength, nullptr,
-                            message.data());
+        GL().GetProgramInfoLog(m_ProgramId, infoLogLength, nullptr,
+                               message.data());
 
         LOG_ERROR("Failed to Link Program:");
         LOG_ERROR("{}", message.data());
     }
+    return status == GL_TRUE;
 }
 } // namespace Core
@@ -0,0 +1,132 @@
+#include "Core/ProgramCache.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+#include "Core/GLBackend.hpp"
+
+#include "Util/Logger.hpp"
+
+#include "config.hpp"
+
+namespace Core {
+ProgramCache::Stats ProgramCache::s_Stats;
+
+namespace {
+// FNV-1a, `std::hash` may change between standard library builds
+std::uint64_t Hash(std::uint64_t hash, const std::string &data) {
+    for (const unsigned char c : data) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    // Keep "ab" + "c" apart from "a" + "bc"
+    hash ^= 0xff;
+    hash *= 0x100000001b3ULL;
+    return hash;
+}
+
+std::string GetGlString(GLenum name) {
+    const auto *value = reinterpret_cast<const char *>(GL().GetString(name));
+    return value != nullptr ? value : "";
+}
+} // namespace
+
+std::string ProgramCache::MakeKey(const std::string &vertexSource,
+                                  const std::string &fragmentSource) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = Hash(hash, GetGlString(GL_VENDOR));
+    hash = Hash(hash, GetGlString(GL_RENDERER));
+    hash = Hash(hash, GetGlString(GL_VERSION));
+    hash = Hash(hash, vertexSource);
+    hash = Hash(hash, fragmentSource);
+
+    return fmt::format("{:016x}", hash);
+}
+
+bool ProgramCache::Load(GLuint program, const std::string &key) {
+    if (!IsEnabled()) {
+        return false;
+    }
+
+    std::ifstream file(GetPath(key), std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    GLenum format = 0;
+    file.read(reinterpret_cast<char *>(&format), sizeof(format));
+    const std::vector<char> binary((std::istreambuf_iterator<char>(file)),
+                                   std::istreambuf_iterator<char>());
+    if (!file || binary.empty()) {
+        LOG_WARN("Program binary '{}' is truncated", key);
+        return false;
+    }
+
+    GL().ProgramBinary(program, format, binary.data(),
+                       static_cast<GLsizei>(binary.size()));
+
+    GLint status = GL_FALSE;
+    GL().GetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        LOG_DEBUG("Program binary '{}' rejected by the driver", key);
+        return false;
+    }
+
+    s_Stats.hits++;
+    return true;
+}
+
+void ProgramCache::Store(GLuint program, const std::string &key) {
+    s_Stats.misses++;
+    if (!IsEnabled()) {
+        return;
+    }
+
+    GLint length = 0;
+    GL().GetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    GLenum format = 0;
+    std::vector<char> binary(length);
+    GL().GetProgramBinary(program, length, nullptr, &format, binary.data());
+
+    std::error_code error;
+    std::filesystem::create_directories(PROGRAM_BINARY_CACHE_DIR, error);
+    if (error) {
+        LOG_WARN("Can't create program cache directory '{}': {}",
+                 PROGRAM_BINARY_CACHE_DIR, error.message());
+        return;
+    }
+
+    std::ofstream file(GetPath(key), std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&format), sizeof(format));
+    file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+    if (!file) {
+        LOG_WARN("Failed to write program binary '{}'", key);
+    }
+}
+
+bool ProgramCache::IsEnabled() {
+    static const bool enabled = [] {
+        if (PROGRAM_BINARY_CACHE_DIR[0] == '\0') {
+            return false;
+        }
+
+        GLint formats = 0;
+        GL().GetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        if (formats == 0) {
+            LOG_INFO("Driver offers no program binary formats, caching off");
+        }
+        return formats > 0;
+    }();
+
+    return enabled;
+}
+
+std::string ProgramCache::GetPath(const std::string &key) {
+    return std::string(PROGRAM_BINARY_CACHE_DIR) + "/" + key + ".bin";
+}
+} // namespace Core
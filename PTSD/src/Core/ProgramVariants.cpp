@@ -0,0 +1,42 @@
+#include "Core/ProgramVariants.hpp"
+
+#include "Util/Logger.hpp"
+
+namespace Core {
+ProgramVariants::ProgramVariants(std::string vertexShaderFilepath,
+                                 std::string fragmentShaderFilepath,
+                                 std::vector<std::string> defines,
+                                 Initializer initializer)
+    : m_VertexShaderFilepath(std::move(vertexShaderFilepath)),
+      m_FragmentShaderFilepath(std::move(fragmentShaderFilepath)),
+      m_Defines(std::move(defines)),
+      m_Initializer(std::move(initializer)) {}
+
+Program &ProgramVariants::Get(Mask mask) {
+    const Mask known = m_Defines.size() >= 32
+                           ? ~Mask(0)
+                           : (Mask(1) << m_Defines.size()) - 1;
+    mask &= known;
+
+    const auto it = m_Programs.find(mask);
+    if (it != m_Programs.end()) {
+        return *it->second;
+    }
+
+    std::vector<std::string> defines;
+    for (size_t bit = 0; bit < m_Defines.size(); ++bit) {
+        if ((mask & (Mask(1) << bit)) != 0) {
+            defines.push_back(m_Defines[bit]);
+        }
+    }
+
+    auto program = std::make_unique<Program>(
+        m_VertexShaderFilepath, m_FragmentShaderFilepath, defines);
+    if (m_Initializer) {
+        m_Initializer(*program);
+    }
+    LOG_DEBUG("Compiled variant {:#x} of '{}'", mask, m_FragmentShaderFilepath);
+
+    return *m_Programs.emplace(mask, std::move(program)).first->second;
+}
+} // namespace Core
@@ -1,13 +1,18 @@
 #include "Core/Shader.hpp"
 
+#include <cctype>
+
+#include "Core/GLBackend.hpp"
+
 #include "Util/LoadTextFile.hpp"
 #include "Util/Logger.hpp"
 
 namespace Core {
-Shader::Shader(const std::string &filepath, Type shaderType) {
-    m_ShaderId = glCreateShader(static_cast<GLenum>(shaderType));
+Shader::Shader(const std::string &filepath, Type shaderType,
+               const std::vector<std::string> &defines) {
+    m_ShaderId = GL().CreateShader(static_cast<GLenum>(shaderType));
 
-    Compile(Util::LoadTextFile(filepath));
+    Compile(InjectDefines(Util::LoadTextFile(filepath), defines));
     CheckStatus(filepath);
 }
 
@@ -17,7 +22,7 @@ Shader::Shader(Shader &&other) {
 }
 
 Shader::~Shader() {
-    glDeleteShader(m_ShaderId);
+    GL().DeleteShader(m_ShaderId);
 }
 
 Shader &Shader::operator=(Shader &&other) {
@@ -27,23 +32,60 @@ Shader &Shader::operator=(Shader &&other) {
     return *this;
 }
 
+std::string Shader::InjectDefines(const std::string &src,
+                                  const std::vector<std::string> &defines) {
+    if (defines.empty()) {
+        return src;
+    }
+
+    std::string block;
+    for (const auto &define : defines) {
+        block += "#define " + define + "\n";
+    }
+
+    // `#version` has to stay the first directive, only a BOM, whitespace and
+    // comments may come before it
+    std::size_t pos = src.rfind("\xEF\xBB\xBF", 0) == 0 ? 3 : 0;
+    while (pos < src.size()) {
+        if (std::isspace(static_cast<unsigned char>(src[pos])) != 0) {
+            ++pos;
+        } else if (src.compare(pos, 2, "//") == 0) {
+            pos = src.find('\n', pos);
+        } else if (src.compare(pos, 2, "/*") == 0) {
+            pos = src.find("*/", pos + 2);
+            pos = pos == std::string::npos ? pos : pos + 2;
+        } else {
+            break;
+        }
+    }
+    if (pos >= src.size() || src.compare(pos, 8, "#version") != 0) {
+        return block + src;
+    }
+    const auto lineEnd = src.find('\n', pos);
+    if (lineEnd == std::string::npos) {
+        return src + "\n" + block;
+    }
+    return src.substr(0, lineEnd + 1) + block + src.substr(lineEnd + 1);
+}
+
 void Shader::Compile(const std::string &src) const {
     const char *srcPtr = src.c_str();
 
-    glShaderSource(m_ShaderId, 1, &srcPtr, nullptr);
-    glCompileShader(m_ShaderId);
+    GL().ShaderSource(m_ShaderId, 1, &srcPtr, nullptr);
+    GL().CompileShader(m_ShaderId);
 }
 
 void Shader::CheckStatus(const std::string &filepath) const {
     GLint status = GL_FALSE;
 
-    glGetShaderiv(m_ShaderId, GL_COMPILE_STATUS, &status);
+    GL().GetShaderiv(m_ShaderId, GL_COMPILE_STATUS, &status);
     if (status != GL_TRUE) {
         int infoLogLength;
-        glGetShaderiv(m_ShaderId, GL_INFO_LOG_LENGTH, &infoLogLength);
+        GL().GetShaderiv(m_ShaderId, GL_INFO_LOG_LENGTH, &infoLogLength);
 
         std::vector<char> message(infoLogLength + 1);
-        glGetShaderInfoLog(m_ShaderId, infoLogLength, nullptr, message.data());
+        GL().GetShaderInfoLog(m_ShaderId, infoLogLength, nullptr,
+                              message.data());
 
         LOG_ERROR("Failed to Compile Shader: '{}'");
         LOG_ERROR("{}", filepath, message.data());
@@ -0,0 +1,193 @@
+#include "Core/SpriteBatch.hpp"
+
+#include "Core/FrameUniforms.hpp"
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
+#include "Core/GPUTimer.hpp"
+#include "Core/OverdrawView.hpp"
+
+#include "config.hpp"
+
+namespace Core {
+std::unique_ptr<Program> SpriteBatch::s_Program = nullptr;
+std::unique_ptr<Program> SpriteBatch::s_OpaqueProgram = nullptr;
+std::unique_ptr<VertexArray> SpriteBatch::s_VertexArray = nullptr;
+
+std::vector<SpriteBatch::Sprite> SpriteBatch::s_Sprites;
+std::vector<float> SpriteBatch::s_Positions;
+size_t SpriteBatch::s_Capacity = 0;
+glm::mat4 SpriteBatch::s_ViewProjection(0.F);
+
+SpriteBatch::Stats SpriteBatch::s_Stats;
+SpriteBatch::Stats SpriteBatch::s_LastFrameStats;
+
+void SpriteBatch::Submit(const Texture &texture, const Matrices &data,
+                         bool opaque) {
+    // Every queued quad shares one camera
+    if (!s_Sprites.empty() && data.m_Projection != s_ViewProjection) {
+        Flush();
+    }
+    s_ViewProjection = data.m_Projection;
+
+    // Same unit quad as the one `Util::Image` used to draw
+    constexpr std::array<glm::vec4, 4> quad = {
+        glm::vec4{-0.5F, 0.5F, 0, 1},
+        glm::vec4{-0.5F, -0.5F, 0, 1},
+        glm::vec4{0.5F, -0.5F, 0, 1},
+        glm::vec4{0.5F, 0.5F, 0, 1},
+    };
+
+    Sprite sprite{};
+    sprite.texture = texture.GetTextureId();
+    sprite.z = data.m_Model[3][2];
+    sprite.opaque = opaque;
+    for (size_t i = 0; i < quad.size(); ++i) {
+        sprite.corners[i] = glm::vec3(data.m_Model * quad[i]);
+    }
+
+    s_Sprites.push_back(sprite);
+    s_Stats.sprites++;
+}
+
+void SpriteBatch::Flush() {
+    if (s_Sprites.empty()) {
+        return;
+    }
+    if (s_Program == nullptr) {
+        Init();
+    }
+    GPUTimerScope timer("Sprites");
+
+    const auto translucent =
+        std::stable_partition(s_Sprites.begin(), s_Sprites.end(),
+                              [](const Sprite &s) { return s.opaque; });
+    // Higher z-index is nearer the camera
+    std::stable_sort(s_Sprites.begin(), translucent,
+                     [](const Sprite &a, const Sprite &b) {
+                         if (a.z != b.z) {
+                             return a.z > b.z;
+                         }
+                         return a.texture < b.texture;
+                     });
+    std::stable_sort(translucent, s_Sprites.end(),
+                     [](const Sprite &a, const Sprite &b) {
+                         if (a.z != b.z) {
+                             return a.z < b.z;
+                         }
+                         return a.texture < b.texture;
+                     });
+    const auto opaqueCount =
+        static_cast<size_t>(std::distance(s_Sprites.begin(), translucent));
+
+    Reserve(s_Sprites.size());
+
+    s_Positions.clear();
+    for (const auto &sprite : s_Sprites) {
+        for (const auto &corner : sprite.corners) {
+            s_Positions.insert(s_Positions.end(), {corner.x, corner.y, corner.z});
+        }
+    }
+
+    FrameUniforms::UploadCamera(s_ViewProjection);
+
+    s_VertexArray->Bind();
+    s_VertexArray->GetVertexBuffer(0).SetData(s_Positions);
+
+    if (OverdrawView::IsEnabled()) {
+        OverdrawView::Begin();
+        DrawRuns(0, s_Sprites.size());
+        OverdrawView::End();
+    } else {
+        // Mostly the full screen background
+        GPUTimer::Begin("Opaque sprites");
+        s_OpaqueProgram->Bind();
+        s_OpaqueProgram->Validate();
+        GLState::SetBlend(false);
+        DrawRuns(0, opaqueCount);
+
+        GPUTimer::Begin("Sprites");
+        s_Program->Bind();
+        s_Program->Validate();
+        GLState::SetBlend(true);
+        DrawRuns(opaqueCount, s_Sprites.size());
+    }
+    s_Stats.opaque += static_cast<unsigned int>(opaqueCount);
+
+    s_Sprites.clear();
+}
+
+void SpriteBatch::DrawRuns(size_t first, size_t last) {
+    size_t runStart = first;
+    for (size_t i = first + 1; i <= last; ++i) {
+        if (i < last && s_Sprites[i].texture == s_Sprites[runStart].texture) {
+            continue;
+        }
+
+        GLState::BindTexture(UNIFORM_SURFACE_LOCATION,
+                             s_Sprites[runStart].texture);
+        s_VertexArray->DrawTriangleRange(static_cast<GLsizei>(runStart * 6),
+                                         static_cast<GLsizei>((i - runStart) * 6));
+        s_Stats.draws++;
+        runStart = i;
+    }
+}
+
+void SpriteBatch::NewFrame() {
+    s_LastFrameStats = s_Stats;
+    s_Stats = {};
+}
+
+void SpriteBatch::Init() {
+    s_Program =
+        std::make_unique<Program>(PTSD_ASSETS_DIR "/shaders/Sprite.vert",
+                                  PTSD_ASSETS_DIR "/shaders/Base.frag");
+    s_OpaqueProgram =
+        std::make_unique<Program>(PTSD_ASSETS_DIR "/shaders/Sprite.vert",
+                                  PTSD_ASSETS_DIR "/shaders/Opaque.frag");
+
+    for (const auto *program : {s_Program.get(), s_OpaqueProgram.get()}) {
+        FrameUniforms::Attach(*program);
+        program->Bind();
+
+        GLint location = GL().GetUniformLocation(program->GetId(), "surface");
+        GL().Uniform1i(location, UNIFORM_SURFACE_LOCATION);
+    }
+
+    s_VertexArray = std::make_unique<VertexArray>();
+    s_VertexArray->AddVertexBuffer(
+        std::make_unique<VertexBuffer>(std::vector<float>{}, 3));
+    s_VertexArray->AddVertexBuffer(
+        std::make_unique<VertexBuffer>(std::vector<float>{}, 2));
+    s_VertexArray->SetIndexBuffer(
+        std::make_unique<IndexBuffer>(std::vector<unsigned int>{}));
+}
+
+void SpriteBatch::Reserve(size_t count) {
+    if (count <= s_Capacity) {
+        return;
+    }
+    // Grow geometrically so a busy frame doesn't reupload every flush
+    s_Capacity = std::max(count, s_Capacity * 2);
+
+    // UVs and indices are the same for every quad, only positions change
+    std::vector<float> uvs;
+    std::vector<unsigned int> indices;
+    uvs.reserve(s_Capacity * 8);
+    indices.reserve(s_Capacity * 6);
+    for (unsigned int q = 0; q < s_Capacity; ++q) {
+        const unsigned int base = q * 4;
+        uvs.insert(uvs.end(), {
+                                  0.0F, 0.0F, //
+                                  0.0F, 1.0F, //
+                                  1.0F, 1.0F, //
+                                  1.0F, 0.0F, //
+                              });
+        indices.insert(indices.end(), {base, base + 1, base + 2, //
+                                       base, base + 2, base + 3});
+    }
+
+    s_VertexArray->Bind();
+    s_VertexArray->GetVertexBuffer(1).SetData(uvs);
+    s_VertexArray->GetIndexBuffer().SetData(indices);
+}
+} // namespace Core
@@ -1,45 +1,48 @@
 #include "Core/Texture.hpp"
 
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
 #include "Core/TextureUtils.hpp"
 
 #include "Util/Logger.hpp"
 
 namespace Core {
-Texture::Texture(GLint format, int width, int height, const void *data) {
-    glGenTextures(1, &m_TextureId);
+Texture::Texture(GLint format, int width, int height, const void *data,
+                 Filter filter)
+    : m_Filter(filter) {
+    GL().GenTextures(1, &m_TextureId);
     UpdateData(format, width, height, data);
 }
 
-Texture::Texture(Texture &&texture) {
+Texture::Texture(Texture &&texture)
+    : m_Filter(texture.m_Filter) {
     m_TextureId = texture.m_TextureId;
     texture.m_TextureId = 0;
 }
 
 Texture::~Texture() {
-    glDeleteTextures(1, &m_TextureId);
+    GLState::ForgetTexture(m_TextureId);
+    GL().DeleteTextures(1, &m_TextureId);
 }
 
 Texture &Texture::operator=(Texture &&other) {
     m_TextureId = other.m_TextureId;
+    m_Filter = other.m_Filter;
     other.m_TextureId = 0;
     return *this;
 }
 
 void Texture::Bind(int slot) const {
-    int maxCount;
-    glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &maxCount);
-
-    if (slot >= maxCount) {
+    if (slot >= GLState::GetMaxTextureUnits()) {
         LOG_ERROR("Maximum texture count exceeded");
         return;
     }
 
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, m_TextureId);
+    GLState::BindTexture(slot, m_TextureId);
 }
 
 void Texture::Unbind() const {
-    glBindTexture(GL_TEXTURE_2D, 0);
+    GLState::BindTexture(0, 0);
 }
 
 /**
@@ -49,14 +52,31 @@ void Texture::Unbind() const {
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void Texture::UpdateData(GLint format, int width, int height,
                          const void *data) {
-    glBindTexture(GL_TEXTURE_2D, m_TextureId);
+    GLState::BindTexture(0, m_TextureId);
 
     // Reference:
     // https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexImage2D.xhtml
-    glTexImage2D(GL_TEXTURE_2D, 0, GlFormatToGlInternalFormat(format), width,
-                 height, 0, format, GL_UNSIGNED_BYTE, data);
+    GL().TexImage2D(GL_TEXTURE_2D, 0, GlFormatToGlInternalFormat(format), width,
+                    height, 0, format, GL_UNSIGNED_BYTE, data);
+
+    if (m_Filter == Filter::TRILINEAR) {
+        GL().GenerateMipmap(GL_TEXTURE_2D);
+        GL().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                           GL_LINEAR_MIPMAP_LINEAR);
+    } else {
+        GL().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    }
+    GL().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void Texture::UpdateSubData(int x, int y, int width, int height, GLint format,
+                            int rowLength, const void *data) {
+    GLState::BindTexture(0, m_TextureId);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    GL().PixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+    GL().TexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format,
+                       GL_UNSIGNED_BYTE, data);
+    GL().PixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 }
 } // namespace Core
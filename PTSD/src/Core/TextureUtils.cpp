@@ -33,4 +33,96 @@ GLint GlFormatToGlInternalFormat(GLint format) {
         return -1;
     }
 }
+
+bool IsSurfaceOpaque(SDL_Surface *surface) {
+    const SDL_PixelFormat *format = surface->format;
+    if (!SDL_ISPIXELFORMAT_ALPHA(format->format)) {
+        return true;
+    }
+    // Only the 32 bit formats `SdlFormatToGlFormat()` accepts carry alpha
+    if (format->BytesPerPixel != 4) {
+        return false;
+    }
+
+    if (SDL_MUSTLOCK(surface)) {
+        SDL_LockSurface(surface);
+    }
+
+    bool opaque = true;
+    const auto *pixels = static_cast<const Uint8 *>(surface->pixels);
+    for (int y = 0; y < surface->h && opaque; ++y) {
+        const auto *row = reinterpret_cast<const Uint32 *>(
+            pixels + static_cast<std::ptrdiff_t>(y) * surface->pitch);
+        for (int x = 0; x < surface->w; ++x) {
+            if ((row[x] & format->Amask) != format->Amask) {
+                opaque = false;
+                break;
+            }
+        }
+    }
+
+    if (SDL_MUSTLOCK(surface)) {
+        SDL_UnlockSurface(surface);
+    }
+    return opaque;
+}
+
+SDL_Surface *DownscaleSurface(SDL_Surface *surface, int levels) {
+    SDL_Surface *result =
+        SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    if (result == nullptr) {
+        LOG_ERROR("Failed to convert surface for downscaling: {}",
+                  SDL_GetError());
+        return nullptr;
+    }
+
+    for (int level = 0; level < levels; ++level) {
+        const int width = (result->w + 1) / 2;
+        const int height = (result->h + 1) / 2;
+        if (width == result->w && height == result->h) {
+            break;
+        }
+
+        SDL_Surface *half = SDL_CreateRGBSurfaceWithFormat(
+            0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+        const auto *src = static_cast<const Uint8 *>(result->pixels);
+        auto *dst = static_cast<Uint8 *>(half->pixels);
+
+        for (int y = 0; y < height; ++y) {
+            const int rows[2] = {2 * y, std::min(2 * y + 1, result->h - 1)};
+            for (int x = 0; x < width; ++x) {
+                const int columns[2] = {2 * x,
+                                        std::min(2 * x + 1, result->w - 1)};
+
+                unsigned int color[3] = {0, 0, 0};
+                unsigned int alpha = 0;
+                for (const int row : rows) {
+                    for (const int column : columns) {
+                        const Uint8 *texel =
+                            src + static_cast<std::ptrdiff_t>(row) *
+                                      result->pitch +
+                            column * 4;
+                        color[0] += texel[0] * texel[3];
+                        color[1] += texel[1] * texel[3];
+                        color[2] += texel[2] * texel[3];
+                        alpha += texel[3];
+                    }
+                }
+
+                Uint8 *out =
+                    dst + static_cast<std::ptrdiff_t>(y) * half->pitch + x * 4;
+                for (int channel = 0; channel < 3; ++channel) {
+                    out[channel] = static_cast<Uint8>(
+                        alpha == 0 ? 0 : (color[channel] + alpha / 2) / alpha);
+                }
+                out[3] = static_cast<Uint8>((alpha + 2) / 4);
+            }
+        }
+
+        SDL_FreeSurface(result);
+        result = half;
+    }
+
+    return result;
+}
 } // namespace Core
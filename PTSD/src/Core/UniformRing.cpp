@@ -0,0 +1,118 @@
+#include "Core/UniformRing.hpp"
+
+#include <cstring>
+
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
+
+#include "Util/Logger.hpp"
+
+namespace Core {
+UniformRing::UniformRing(GLuint binding, GLsizeiptr segmentSize,
+                         unsigned int segmentCount)
+    : m_Binding(binding),
+      m_SegmentSize(segmentSize),
+      m_Fences(segmentCount, nullptr) {
+    GL().GetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &m_Alignment);
+
+    GL().GenBuffers(1, &m_BufferId);
+    GLState::BindUniformBuffer(m_BufferId);
+
+    if (GLEW_ARB_buffer_storage) {
+        constexpr GLbitfield flags =
+            GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        const auto capacity = m_SegmentSize * m_Fences.size();
+
+        GL().BufferStorage(GL_UNIFORM_BUFFER, capacity, nullptr, flags);
+        m_Mapped = static_cast<char *>(
+            GL().MapBufferRange(GL_UNIFORM_BUFFER, 0, capacity, flags));
+    }
+
+    if (m_Mapped == nullptr) {
+        // Orphaning path, segments are only used for the fallback capacity
+        m_SegmentSize *= static_cast<GLsizeiptr>(m_Fences.size());
+        m_Fences.assign(1, nullptr);
+        GL().BufferData(GL_UNIFORM_BUFFER, m_SegmentSize, nullptr,
+                        GL_STREAM_DRAW);
+    }
+}
+
+UniformRing::~UniformRing() {
+    for (auto fence : m_Fences) {
+        if (fence != nullptr) {
+            GL().DeleteSync(fence);
+        }
+    }
+
+    if (m_Mapped != nullptr) {
+        GLState::BindUniformBuffer(m_BufferId);
+        GL().UnmapBuffer(GL_UNIFORM_BUFFER);
+    }
+
+    GLState::ForgetBuffer(m_BufferId);
+    GL().DeleteBuffers(1, &m_BufferId);
+}
+
+void UniformRing::Push(const void *data, GLsizeiptr size) {
+    if (size > m_SegmentSize) {
+        LOG_ERROR("Uniform block of {} bytes does not fit in the ring", size);
+        return;
+    }
+
+    GLsizeiptr offset = (m_Offset + m_Alignment - 1) / m_Alignment * m_Alignment;
+    if (offset + size > m_SegmentSize) {
+        NextSegment();
+        offset = 0;
+    }
+    m_Offset = offset + size;
+
+    const GLintptr start = m_Segment * m_SegmentSize + offset;
+    if (m_Mapped != nullptr) {
+        std::memcpy(m_Mapped + start, data, size);
+    } else {
+        GLState::BindUniformBuffer(m_BufferId);
+        GL().BufferSubData(GL_UNIFORM_BUFFER, start, size, data);
+    }
+
+    GLState::BindUniformBufferRange(m_Binding, m_BufferId, start, size);
+}
+
+void UniformRing::NextFrame() {
+    if (m_Mapped != nullptr && m_Offset > 0) {
+        NextSegment();
+    }
+}
+
+void UniformRing::NextSegment() {
+    if (m_Mapped == nullptr) {
+        // Hand the old storage to the driver and keep writing into fresh
+        // memory, draws still reading the old data are not stalled
+        GLState::BindUniformBuffer(m_BufferId);
+        GL().BufferData(GL_UNIFORM_BUFFER, m_SegmentSize, nullptr,
+                        GL_STREAM_DRAW);
+        m_Offset = 0;
+        return;
+    }
+
+    auto &leaving = m_Fences[m_Segment];
+    if (leaving != nullptr) {
+        GL().DeleteSync(leaving);
+    }
+    leaving = GL().FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    m_Segment = (m_Segment + 1) % m_Fences.size();
+    m_Offset = 0;
+
+    auto &entering = m_Fences[m_Segment];
+    if (entering != nullptr) {
+        constexpr GLuint64 timeout = 1000000000; // 1 second in nanoseconds
+        if (GL().ClientWaitSync(entering, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                timeout) == GL_TIMEOUT_EXPIRED) {
+            LOG_WARN("Timed out waiting for uniform ring segment {}",
+                     m_Segment);
+        }
+        GL().DeleteSync(entering);
+        entering = nullptr;
+    }
+}
+} // namespace Core
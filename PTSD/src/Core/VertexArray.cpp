@@ -1,8 +1,11 @@
 #include "Core/VertexArray.hpp"
 
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
+
 namespace Core {
 VertexArray::VertexArray() {
-    glGenVertexArrays(1, &m_ArrayId);
+    GL().GenVertexArrays(1, &m_ArrayId);
 }
 
 VertexArray::VertexArray(VertexArray &&other) {
@@ -14,7 +17,8 @@ VertexArray::VertexArray(VertexArray &&other) {
 }
 
 VertexArray::~VertexArray() {
-    glDeleteVertexArrays(1, &m_ArrayId);
+    GLState::ForgetVertexArray(m_ArrayId);
+    GL().DeleteVertexArrays(1, &m_ArrayId);
 }
 
 VertexArray &VertexArray::operator=(VertexArray &&other) {
@@ -28,22 +32,27 @@ VertexArray &VertexArray::operator=(VertexArray &&other) {
 }
 
 void VertexArray::Bind() const {
-    glBindVertexArray(m_ArrayId);
+    GLState::BindVertexArray(m_ArrayId);
 }
 
 void VertexArray::Unbind() const {
-    glBindVertexArray(0);
+    GLState::BindVertexArray(0);
 }
 
-void VertexArray::AddVertexBuffer(std::unique_ptr<VertexBuffer> vertexBuffer) {
-    glBindVertexArray(m_ArrayId);
+void VertexArray::AddVertexBuffer(std::unique_ptr<VertexBuffer> vertexBuffer,
+                                  GLuint divisor) {
+    GLState::BindVertexArray(m_ArrayId);
 
-    glEnableVertexAttribArray(m_VertexBuffers.size());
+    GL().EnableVertexAttribArray(m_VertexBuffers.size());
     vertexBuffer->Bind();
 
-    glVertexAttribPointer(m_VertexBuffers.size(),
-                          static_cast<GLint>(vertexBuffer->GetComponentCount()),
-                          vertexBuffer->GetType(), GL_FALSE, 0, nullptr);
+    GL().VertexAttribPointer(
+        m_VertexBuffers.size(),
+        static_cast<GLint>(vertexBuffer->GetComponentCount()),
+        vertexBuffer->GetType(), GL_FALSE, 0, nullptr);
+    if (divisor != 0) {
+        GL().VertexAttribDivisor(m_VertexBuffers.size(), divisor);
+    }
 
     m_VertexBuffers.push_back(std::move(vertexBuffer));
 }
@@ -53,7 +62,23 @@ void VertexArray::SetIndexBuffer(std::unique_ptr<IndexBuffer> indexBuffer) {
 }
 
 void VertexArray::DrawTriangles() const {
-    glDrawElements(GL_TRIANGLES, static_cast<GLint>(m_IndexBuffer->GetCount()),
-                   GL_UNSIGNED_INT, nullptr);
+    GLState::CountDraw();
+    GL().DrawElements(GL_TRIANGLES,
+                      static_cast<GLint>(m_IndexBuffer->GetCount()),
+                      GL_UNSIGNED_INT, nullptr);
+}
+
+void VertexArray::DrawTriangleRange(GLsizei first, GLsizei count) const {
+    GLState::CountDraw();
+    GL().DrawElements(
+        GL_TRIANGLES, count, GL_UNSIGNED_INT,
+        reinterpret_cast<const void *>(first * sizeof(GLuint))); // NOLINT
+}
+
+void VertexArray::DrawTrianglesInstanced(GLsizei instanceCount) const {
+    GLState::CountDraw();
+    GL().DrawElementsInstanced(GL_TRIANGLES,
+                               static_cast<GLint>(m_IndexBuffer->GetCount()),
+                               GL_UNSIGNED_INT, nullptr, instanceCount);
 }
 } // namespace Core
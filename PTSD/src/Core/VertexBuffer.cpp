@@ -1,32 +1,37 @@
 #include "Core/VertexBuffer.hpp"
 
+#include "Core/GLBackend.hpp"
+
 namespace Core {
 VertexBuffer::VertexBuffer(const std::vector<float> &vertices,
                            unsigned int componentCount)
-    : m_ComponentCount(componentCount) {
-    glGenBuffers(1, &m_BufferId);
-    glBindBuffer(GL_ARRAY_BUFFER, m_BufferId);
-    glBufferData(GL_ARRAY_BUFFER,
-                 static_cast<GLsizeiptr>(vertices.size() * sizeof(GLfloat)),
-                 vertices.data(), GL_STATIC_DRAW);
+    : m_Capacity(vertices.size()),
+      m_ComponentCount(componentCount) {
+    GL().GenBuffers(1, &m_BufferId);
+    GL().BindBuffer(GL_ARRAY_BUFFER, m_BufferId);
+    GL().BufferData(GL_ARRAY_BUFFER,
+                    static_cast<GLsizeiptr>(vertices.size() * sizeof(GLfloat)),
+                    vertices.data(), GL_STATIC_DRAW);
 }
 
 VertexBuffer::VertexBuffer(VertexBuffer &&other) {
     m_BufferId = other.m_BufferId;
     other.m_BufferId = 0;
 
+    m_Capacity = std::move(other.m_Capacity);
     m_ComponentCount = std::move(other.m_ComponentCount);
     m_Type = std::move(other.m_Type);
 }
 
 VertexBuffer::~VertexBuffer() {
-    glDeleteBuffers(1, &m_BufferId);
+    GL().DeleteBuffers(1, &m_BufferId);
 }
 
 VertexBuffer &VertexBuffer::operator=(VertexBuffer &&other) {
     m_BufferId = other.m_BufferId;
     other.m_BufferId = 0;
 
+    m_Capacity = std::move(other.m_Capacity);
     m_ComponentCount = std::move(other.m_ComponentCount);
     m_Type = std::move(other.m_Type);
 
@@ -34,10 +39,24 @@ VertexBuffer &VertexBuffer::operator=(VertexBuffer &&other) {
 }
 
 void VertexBuffer::Bind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, m_BufferId);
+    GL().BindBuffer(GL_ARRAY_BUFFER, m_BufferId);
 }
 
 void VertexBuffer::Unbind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    GL().BindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void VertexBuffer::SetData(const std::vector<float> &vertices) {
+    const auto size =
+        static_cast<GLsizeiptr>(vertices.size() * sizeof(GLfloat));
+
+    GL().BindBuffer(GL_ARRAY_BUFFER, m_BufferId);
+    if (vertices.size() > m_Capacity) {
+        GL().BufferData(GL_ARRAY_BUFFER, size, vertices.data(),
+                        GL_DYNAMIC_DRAW);
+        m_Capacity = vertices.size();
+    } else {
+        GL().BufferSubData(GL_ARRAY_BUFFER, 0, size, vertices.data());
+    }
 }
 } // namespace Core
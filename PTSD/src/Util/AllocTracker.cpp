@@ -0,0 +1,332 @@
+#include "Util/AllocTracker.hpp"
+
+#ifdef PTSD_ALLOC_TRACKING
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#include "Util/Logger.hpp"
+
+#include "config.hpp"
+
+namespace Util {
+namespace {
+struct Counters {
+    std::atomic<unsigned long long> count;
+    std::atomic<unsigned long long> bytes;
+    std::atomic<unsigned long long> live;
+    std::atomic<unsigned long long> peak;
+};
+
+/*
+ * Everything here is constant initialized, allocations made before `main()`
+ * or after static destructors ran still find it in place. None of it may
+ * allocate either.
+ */
+std::array<Counters, AllocTracker::MAX_TAGS> s_Counters;
+std::array<const char *, AllocTracker::MAX_TAGS> s_Names = {"untagged"};
+std::atomic<std::size_t> s_TagCount{1};
+std::mutex s_NamesMutex;
+
+thread_local std::size_t s_CurrentTag = 0;
+
+std::array<AllocTracker::TagStats, AllocTracker::MAX_TAGS> s_LastFrame;
+unsigned long long s_Frame = 0;
+std::FILE *s_Csv = nullptr;
+
+// Keeps the size and tag of each block in front of it, the block itself stays
+// aligned for anything `operator new` has to hand out
+struct alignas(alignof(std::max_align_t)) Header {
+    std::size_t size;
+    std::size_t tag;
+};
+
+std::size_t FindTag(const char *name) {
+    const std::size_t count = s_TagCount.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (s_Names[i] == name) {
+            return i;
+        }
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (std::strcmp(s_Names[i], name) == 0) {
+            return i;
+        }
+    }
+
+    const std::lock_guard<std::mutex> lock(s_NamesMutex);
+    // Another thread may have added it in the meantime
+    const std::size_t current = s_TagCount.load(std::memory_order_relaxed);
+    for (std::size_t i = count; i < current; ++i) {
+        if (std::strcmp(s_Names[i], name) == 0) {
+            return i;
+        }
+    }
+    if (current == AllocTracker::MAX_TAGS) {
+        return 0;
+    }
+    s_Names[current] = name;
+    s_TagCount.store(current + 1, std::memory_order_release);
+    return current;
+}
+
+void *Allocate(std::size_t size) {
+    for (;;) {
+        if (void *block = std::malloc(sizeof(Header) + size)) {
+            auto *header = static_cast<Header *>(block);
+            header->size = size;
+            header->tag = s_CurrentTag;
+
+            auto &counters = s_Counters[header->tag];
+            counters.count.fetch_add(1, std::memory_order_relaxed);
+            counters.bytes.fetch_add(size, std::memory_order_relaxed);
+            const auto live =
+                counters.live.fetch_add(size, std::memory_order_relaxed) +
+                size;
+            auto peak = counters.peak.load(std::memory_order_relaxed);
+            while (live > peak && !counters.peak.compare_exchange_weak(
+                                      peak, live, std::memory_order_relaxed)) {
+            }
+            return header + 1;
+        }
+
+        const std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            return nullptr;
+        }
+        handler();
+    }
+}
+
+void Free(void *pointer) {
+    if (pointer == nullptr) {
+        return;
+    }
+    auto *header = static_cast<Header *>(pointer) - 1;
+    s_Counters[header->tag].live.fetch_sub(header->size,
+                                           std::memory_order_relaxed);
+    std::free(header);
+}
+} // namespace
+
+void AllocTracker::NewFrame() {
+    const std::size_t tags = GetTagCount();
+    for (std::size_t i = 0; i < tags; ++i) {
+        auto &counters = s_Counters[i];
+        auto &stats = s_LastFrame[i];
+        stats.name = s_Names[i];
+        stats.count = counters.count.exchange(0, std::memory_order_relaxed);
+        stats.bytes = counters.bytes.exchange(0, std::memory_order_relaxed);
+        stats.liveBytes = counters.live.load(std::memory_order_relaxed);
+        stats.peakLiveBytes =
+            counters.peak.exchange(stats.liveBytes, std::memory_order_relaxed);
+
+        if (s_Csv != nullptr && (stats.count != 0 || stats.liveBytes != 0)) {
+            std::fprintf(s_Csv, "%llu,%s,%llu,%llu,%llu,%llu\n", s_Frame,
+                         stats.name, stats.count, stats.bytes, stats.liveBytes,
+                         stats.peakLiveBytes);
+        }
+    }
+    ++s_Frame;
+}
+
+std::size_t AllocTracker::GetTagCount() {
+    return s_TagCount.load(std::memory_order_acquire);
+}
+
+AllocTracker::TagStats AllocTracker::GetLastFrame(std::size_t tag) {
+    return tag < GetTagCount() ? s_LastFrame[tag] : TagStats{};
+}
+
+void AllocTracker::StartCsv(const std::string &path) {
+    StopCsv();
+    s_Csv = std::fopen(path.c_str(), "w");
+    if (s_Csv == nullptr) {
+        LOG_WARN("Can't write allocations to '{}'", path);
+        return;
+    }
+    std::fputs("frame,tag,count,bytes,live_bytes,peak_live_bytes\n", s_Csv);
+    LOG_INFO("Writing allocations per frame to '{}'", path);
+}
+
+void AllocTracker::StopCsv() {
+    if (s_Csv != nullptr) {
+        std::fclose(s_Csv);
+        s_Csv = nullptr;
+    }
+}
+
+bool AllocTracker::IsWritingCsv() {
+    return s_Csv != nullptr;
+}
+
+void AllocTracker::DrawWindow() {
+    if (!ImGui::Begin("Allocations")) {
+        ImGui::End();
+        return;
+    }
+
+    bool csv = IsWritingCsv();
+    if (ImGui::Checkbox("Write CSV", &csv)) {
+        if (csv) {
+            StartCsv(ALLOC_TRACKING_CSV_PATH);
+        } else {
+            StopCsv();
+        }
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("%s", ALLOC_TRACKING_CSV_PATH);
+
+    constexpr ImGuiTableFlags flags =
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+        ImGuiTableFlags_Sortable | ImGuiTableFlags_SizingFixedFit;
+    if (ImGui::BeginTable("tags", 5, flags)) {
+        ImGui::TableSetupColumn("Tag");
+        ImGui::TableSetupColumn(
+            "Allocs", ImGuiTableColumnFlags_DefaultSort |
+                          ImGuiTableColumnFlags_PreferSortDescending);
+        ImGui::TableSetupColumn("Bytes");
+        ImGui::TableSetupColumn("Live bytes");
+        ImGui::TableSetupColumn("Peak live bytes");
+        ImGui::TableHeadersRow();
+
+        const std::size_t tags = GetTagCount();
+        std::array<std::size_t, MAX_TAGS> order = {};
+        for (std::size_t i = 0; i < tags; ++i) {
+            order[i] = i;
+        }
+        if (const auto *sort = ImGui::TableGetSortSpecs();
+            sort != nullptr && sort->SpecsCount > 0) {
+            const auto &spec = sort->Specs[0];
+            const auto key = [&spec](std::size_t tag) {
+                const auto &stats = s_LastFrame[tag];
+                switch (spec.ColumnIndex) {
+                case 1:
+                    return stats.count;
+                case 2:
+                    return stats.bytes;
+                case 3:
+                    return stats.liveBytes;
+                case 4:
+                    return stats.peakLiveBytes;
+                default:
+                    return static_cast<unsigned long long>(tag);
+                }
+            };
+            const bool descending =
+                spec.SortDirection == ImGuiSortDirection_Descending;
+            std::sort(order.begin(), order.begin() + tags,
+                      [&](std::size_t a, std::size_t b) {
+                          return descending ? key(a) > key(b)
+                                            : key(a) < key(b);
+                      });
+        }
+
+        for (std::size_t i = 0; i < tags; ++i) {
+            const auto &stats = s_LastFrame[order[i]];
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(s_Names[order[i]]);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", stats.count);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", stats.bytes);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", stats.liveBytes);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", stats.peakLiveBytes);
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+AllocScope::AllocScope(const char *tag)
+    : m_Previous(s_CurrentTag) {
+    s_CurrentTag = FindTag(tag);
+}
+
+AllocScope::~AllocScope() {
+    s_CurrentTag = m_Previous;
+}
+} // namespace Util
+
+/*
+ * Replacing these replaces every other form, the library's array, sized and
+ * nothrow versions forward to them. The nothrow ones are replaced as well
+ * since older standard libraries call `malloc` from them directly.
+ * Over-aligned allocations keep the library's versions and go untracked.
+ */
+void *operator new(std::size_t size) {
+    if (void *pointer = Util::Allocate(size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return Util::Allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return Util::Allocate(size);
+}
+
+void operator delete(void *pointer) noexcept {
+    Util::Free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+    Util::Free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    Util::Free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+    Util::Free(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+    Util::Free(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+    Util::Free(pointer);
+}
+#else
+namespace Util {
+void AllocTracker::NewFrame() {}
+
+std::size_t AllocTracker::GetTagCount() {
+    return 0;
+}
+
+AllocTracker::TagStats AllocTracker::GetLastFrame(std::size_t) {
+    return {};
+}
+
+void AllocTracker::StartCsv(const std::string &) {}
+
+void AllocTracker::StopCsv() {}
+
+bool AllocTracker::IsWritingCsv() {
+    return false;
+}
+
+void AllocTracker::DrawWindow() {}
+
+AllocScope::AllocScope(const char *)
+    : m_Previous(0) {}
+
+AllocScope::~AllocScope() = default;
+} // namespace Util
+#endif
@@ -15,6 +15,18 @@ Animation::Animation(const std::vector<std::string> &paths, bool play,
     }
 }
 
+Animation::Animation(AssetRange frames, bool play, std::size_t interval,
+                     bool looping, std::size_t cooldown)
+    : m_State(play ? State::PLAY : State::PAUSE),
+      m_Interval(interval),
+      m_Looping(looping),
+      m_Cooldown(cooldown) {
+    m_Frames.reserve(frames.size());
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        m_Frames.push_back(std::make_shared<Util::Image>(frames[i]));
+    }
+}
+
 void Animation::SetCurrentFrame(std::size_t index) {
     m_Index = index;
     if (m_State == State::ENDED || m_State == State::COOLDOWN) {
@@ -46,7 +58,8 @@ void Animation::Pause() {
 }
 
 void Animation::Update() {
-    unsigned long nowTime = Util::Time::GetElapsedTimeMs();
+    const Clock &clock = Time::GetClock(m_ClockDomain);
+    const double nowTime = clock.GetElapsedMs();
     if (m_State == State::PAUSE || m_State == State::ENDED) {
         LOG_TRACE("[ANI] is pause");
         return;
@@ -59,7 +72,7 @@ void Animation::Update() {
         return;
     }
 
-    m_TimeBetweenFrameUpdate += Util::Time::GetDeltaTimeMs();
+    m_TimeBetweenFrameUpdate += clock.GetDeltaMs();
     auto updateFrameCount =
         static_cast<unsigned int>(m_TimeBetweenFrameUpdate / m_Interval);
     if (updateFrameCount <= 0)
@@ -0,0 +1,24 @@
+#include "Util/AssetRegistry.hpp"
+
+namespace Util {
+std::deque<std::string> AssetRegistry::s_Paths;
+std::unordered_map<std::string_view, AssetId> AssetRegistry::s_Ids;
+AssetRegistry::Stats AssetRegistry::s_Stats;
+
+AssetId AssetRegistry::Intern(const std::string &path) {
+    s_Stats.hashedLookups++;
+
+    const auto it = s_Ids.find(path);
+    if (it != s_Ids.end()) {
+        return it->second;
+    }
+
+    const auto id = static_cast<AssetId>(s_Paths.size());
+    s_Paths.push_back(path);
+    s_Ids.emplace(s_Paths.back(), id);
+
+    s_Stats.assets = s_Paths.size();
+    s_Stats.pathBytes += path.size();
+    return id;
+}
+} // namespace Util
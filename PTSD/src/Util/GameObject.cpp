@@ -2,8 +2,24 @@
 #include "Util/Transform.hpp"
 #include "Util/TransformUtils.hpp"
 
+#include "config.hpp"
+
 namespace Util {
 
+bool GameObject::IsOutsideWindow() const {
+    if (m_Drawable == nullptr) {
+        return false;
+    }
+
+    const float radius = glm::length(GetScaledSize()) / 2 +
+                         glm::length(m_Pivot * m_Transform.scale);
+    const glm::vec2 halfWindow = {WINDOW_WIDTH / 2.0F, WINDOW_HEIGHT / 2.0F};
+    const glm::vec2 distance = glm::abs(m_Transform.translation);
+
+    return distance.x - radius > halfWindow.x ||
+           distance.y - radius > halfWindow.y;
+}
+
 void GameObject::Draw() {
     if (!m_Visible || m_Drawable == nullptr) {
         return;
@@ -0,0 +1,125 @@
+#include "Util/GlyphAtlas.hpp"
+
+#include "Core/TextureUtils.hpp"
+
+#include "Util/Logger.hpp"
+
+namespace Util {
+std::shared_ptr<GlyphAtlas> GlyphAtlas::Get(const std::string &font,
+                                            int size) {
+    auto &entry = s_Cache[{font, size}];
+
+    auto atlas = entry.lock();
+    if (atlas == nullptr) {
+        atlas = std::make_shared<GlyphAtlas>(font, size);
+        entry = atlas;
+    }
+    return atlas;
+}
+
+GlyphAtlas::GlyphAtlas(const std::string &font, int size)
+    : m_Font(TTF_OpenFont(font.c_str(), size), TTF_CloseFont) {
+    if (m_Font == nullptr) {
+        LOG_ERROR("Failed to load font: '{}'", font);
+        LOG_ERROR("{}", TTF_GetError());
+    } else {
+        m_LineSkip = static_cast<float>(TTF_FontLineSkip(m_Font.get()));
+        m_Height = static_cast<float>(TTF_FontHeight(m_Font.get()));
+    }
+
+    Clear();
+}
+
+const GlyphAtlas::Glyph *GlyphAtlas::GetGlyph(Uint32 codepoint) {
+    auto it = m_Glyphs.find(codepoint);
+    if (it != m_Glyphs.end()) {
+        return &it->second;
+    }
+
+    if (m_Font == nullptr) {
+        return nullptr;
+    }
+
+    int advance = 0;
+    if (TTF_GlyphMetrics32(m_Font.get(), codepoint, nullptr, nullptr, nullptr,
+                           nullptr, &advance) != 0) {
+        return nullptr;
+    }
+
+    // Rendered white, `Util::Text` tints it in the shader
+    auto surface = std::unique_ptr<SDL_Surface, void (*)(SDL_Surface *)>{
+        TTF_RenderGlyph32_Blended(m_Font.get(), codepoint,
+                                  SDL_Color{255, 255, 255, 255}),
+        SDL_FreeSurface,
+    };
+
+    Glyph glyph{};
+    glyph.advance = static_cast<float>(advance);
+
+    if (surface != nullptr && surface->w > 0 && surface->h > 0) {
+        if (surface->w + 2 * PADDING > ATLAS_SIZE ||
+            surface->h + 2 * PADDING > ATLAS_SIZE) {
+            LOG_WARN("Glyph U+{:04X} is too large for the atlas", codepoint);
+            return nullptr;
+        }
+
+        glm::ivec2 origin;
+        if (!Pack(surface->w, surface->h, origin)) {
+            // Most of what fills it up are glyphs of strings long gone, start
+            // over and let the strings still shown bring theirs back
+            LOG_DEBUG("Glyph atlas is full, clearing it");
+            Clear();
+            Pack(surface->w, surface->h, origin);
+        }
+
+        m_Texture->UpdateSubData(
+            origin.x, origin.y, surface->w, surface->h,
+            Core::SdlFormatToGlFormat(surface->format->format),
+            surface->pitch / surface->format->BytesPerPixel, surface->pixels);
+
+        glyph.size = {surface->w, surface->h};
+        glyph.uvMin = glm::vec2(origin) / static_cast<float>(ATLAS_SIZE);
+        glyph.uvMax = glm::vec2(origin.x + surface->w, origin.y + surface->h) /
+                      static_cast<float>(ATLAS_SIZE);
+    }
+
+    return &m_Glyphs.emplace(codepoint, glyph).first->second;
+}
+
+bool GlyphAtlas::Pack(int width, int height, glm::ivec2 &origin) {
+    // Shelf packing: fill a row left to right, start a new row below the
+    // tallest glyph of the current one when it runs out
+    if (m_ShelfX + width + PADDING > ATLAS_SIZE) {
+        m_ShelfX = PADDING;
+        m_ShelfY += m_ShelfHeight + PADDING;
+        m_ShelfHeight = 0;
+    }
+    if (m_ShelfY + height + PADDING > ATLAS_SIZE ||
+        width + 2 * PADDING > ATLAS_SIZE) {
+        return false;
+    }
+
+    origin = {m_ShelfX, m_ShelfY};
+    m_ShelfX += width + PADDING;
+    m_ShelfHeight = std::max(m_ShelfHeight, height);
+    return true;
+}
+
+void GlyphAtlas::Clear() {
+    // Cleared so linear filtering at glyph edges only picks up transparency
+    std::vector<Uint8> blank(ATLAS_SIZE * ATLAS_SIZE * 4, 0);
+    m_Texture = std::make_unique<Core::Texture>(GL_RGBA, ATLAS_SIZE,
+                                                ATLAS_SIZE, blank.data());
+
+    if (!m_Glyphs.empty()) {
+        m_Glyphs.clear();
+        ++m_Generation;
+    }
+    m_ShelfX = PADDING;
+    m_ShelfY = PADDING;
+    m_ShelfHeight = 0;
+}
+
+std::map<std::pair<std::string, int>, std::weak_ptr<GlyphAtlas>>
+    GlyphAtlas::s_Cache;
+} // namespace Util
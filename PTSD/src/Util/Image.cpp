@@ -3,6 +3,7 @@
 #include "Util/Logger.hpp"
 #include "pch.hpp"
 
+#include "Core/SpriteBatch.hpp"
 #include "Core/Texture.hpp"
 #include "Core/TextureUtils.hpp"
 
@@ -10,6 +11,10 @@
 #include "Util/TransformUtils.hpp"
 
 #include "config.hpp"
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <glm/fwd.hpp>
 
 std::shared_ptr<SDL_Surface> LoadSurface(const std::string &filepath) {
@@ -25,95 +30,292 @@ std::shared_ptr<SDL_Surface> LoadSurface(const std::string &filepath) {
     return surface;
 }
 
+std::size_t GetSurfaceBytes(const std::shared_ptr<SDL_Surface> &surface) {
+    return sizeof(SDL_Surface) +
+           static_cast<std::size_t>(surface->pitch) * surface->h;
+}
+
+namespace {
+/**
+ * Bytes per texel of what `Core::Texture` allocates for `format`, which is
+ * 16 bits per channel and not what it is given.
+ */
+std::size_t GetTexelBytes(GLint format) {
+    switch (Core::GlFormatToGlInternalFormat(format)) {
+    case GL_RGB16:
+        return 6;
+    case GL_RGBA16:
+        return 8;
+    default:
+        return 4;
+    }
+}
+
+struct CookedHeader {
+    std::uint32_t version;
+    std::int32_t sourceWidth;
+    std::int32_t sourceHeight;
+    std::int32_t width;
+    std::int32_t height;
+    std::uint32_t opaque;
+};
+
+constexpr std::uint32_t COOKED_VERSION = 1;
+
+std::string GetCookedPath(const std::string &source, std::size_t levels) {
+    // FNV-1a, `std::hash` may change between standard library builds
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const unsigned char c : source) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    return fmt::format("{}/{:016x}_{}.tex", COOKED_TEXTURE_DIR, hash, levels);
+}
+
+// Same rounding as `Core::DownscaleSurface()`
+int HalveSize(int size, std::size_t levels) {
+    for (std::size_t i = 0; i < levels; ++i) {
+        size = (size + 1) / 2;
+    }
+    return size;
+}
+
+bool LoadCooked(const std::string &path, const std::string &source,
+                std::size_t levels, CookedHeader &header,
+                std::vector<Uint8> &pixels) {
+    std::error_code error;
+    const auto cookedTime = std::filesystem::last_write_time(path, error);
+    if (error) {
+        return false;
+    }
+    const auto sourceTime = std::filesystem::last_write_time(source, error);
+    if (error || sourceTime > cookedTime) {
+        return false;
+    }
+
+    const auto fileSize = std::filesystem::file_size(path, error);
+    if (error) {
+        return false;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!file || header.version != COOKED_VERSION) {
+        return false;
+    }
+
+    // A truncated or corrupt file is cooked again instead of trusted
+    if (header.sourceWidth <= 0 || header.sourceHeight <= 0 ||
+        header.width != HalveSize(header.sourceWidth, levels) ||
+        header.height != HalveSize(header.sourceHeight, levels) ||
+        fileSize != sizeof(header) + static_cast<std::uintmax_t>(header.width) *
+                                         header.height * 4) {
+        LOG_WARN("Ignoring corrupt cooked texture '{}'", path);
+        return false;
+    }
+
+    pixels.resize(static_cast<std::size_t>(header.width) * header.height * 4);
+    file.read(reinterpret_cast<char *>(pixels.data()),
+              static_cast<std::streamsize>(pixels.size()));
+    if (!file) {
+        pixels.clear();
+        return false;
+    }
+    return true;
+}
+
+void StoreCooked(const std::string &path, const CookedHeader &header,
+                 const std::vector<Uint8> &pixels) {
+    std::error_code error;
+    std::filesystem::create_directories(COOKED_TEXTURE_DIR, error);
+    if (error) {
+        LOG_WARN("Can't create cooked texture directory '{}': {}",
+                 COOKED_TEXTURE_DIR, error.message());
+        return;
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(pixels.data()),
+               static_cast<std::streamsize>(pixels.size()));
+    if (!file) {
+        LOG_WARN("Failed to write cooked texture '{}'", path);
+    }
+}
+} // namespace
+
 namespace Util {
-Image::Image(const std::string &filepath)
-    : m_Path(filepath) {
-    if (s_Program == nullptr) {
-        InitProgram();
+struct Image::SharedTexture {
+    SharedTexture(AssetId id, std::size_t variant, GLint format, int width,
+                  int height, const void *pixels, glm::vec2 size, bool opaque)
+        : id(id),
+          variant(variant),
+          texture(format, width, height, pixels,
+                  variant == 0 ? Core::Texture::Filter::LINEAR
+                               : Core::Texture::Filter::TRILINEAR),
+          size(size),
+          bytes(GetBytes(format, width, height)),
+          saved(GetBytes(format, static_cast<int>(size.x),
+                         static_cast<int>(size.y)) -
+                bytes),
+          opaque(opaque) {
+        s_TextureStats.textures++;
+        s_TextureStats.bytes += bytes;
+        s_TextureStats.savedBytes += saved;
     }
-    if (s_VertexArray == nullptr) {
-        InitVertexArray();
+    SharedTexture(const SharedTexture &) = delete;
+    SharedTexture(SharedTexture &&) = delete;
+
+    ~SharedTexture() {
+        GetTextures()[id][variant].reset();
+        s_TextureStats.textures--;
+        s_TextureStats.bytes -= bytes;
+        s_TextureStats.savedBytes -= saved;
     }
 
-    m_UniformBuffer = std::make_unique<Core::UniformBuffer<Core::Matrices>>(
-        *s_Program, "Matrices", 0);
+    SharedTexture &operator=(const SharedTexture &) = delete;
+    SharedTexture &operator=(SharedTexture &&) = delete;
+
+    std::size_t GetBytes(GLint format, int width, int height) const {
+        const auto level0 =
+            static_cast<std::size_t>(width) * height * GetTexelBytes(format);
+        // The mip chain adds about a third
+        return variant == 0 ? level0 : level0 + level0 / 3;
+    }
 
-    auto surface = s_Store.Get(filepath);
+    AssetId id;
+    std::size_t variant;
+    Core::Texture texture;
+    glm::vec2 size;
+    std::size_t bytes;
+    std::size_t saved;
+    bool opaque;
+};
 
-    m_Texture = std::make_unique<Core::Texture>(
-        Core::SdlFormatToGlFormat(surface->format->format), surface->w,
-        surface->h, surface->pixels);
-    m_Size = {surface->w, surface->h};
+Image::Image(const std::string &filepath, float maxScale)
+    : Image(AssetRegistry::Intern(filepath), maxScale) {}
+
+Image::Image(AssetId id, float maxScale)
+    : m_Texture(AcquireTexture(id, GetVariant(maxScale))),
+      m_Variant(GetVariant(maxScale)) {}
+
+glm::vec2 Image::GetSize() const {
+    return m_Texture->size;
 }
 
 void Image::SetImage(const std::string &filepath) {
-    auto surface = s_Store.Get(filepath);
+    SetImage(AssetRegistry::Intern(filepath));
+}
 
-    m_Texture->UpdateData(Core::SdlFormatToGlFormat(surface->format->format),
-                          surface->w, surface->h, surface->pixels);
-    m_Size = {surface->w, surface->h};
+void Image::SetImage(AssetId id) {
+    m_Texture = AcquireTexture(id, m_Variant);
 }
 
 void Image::Draw(const Core::Matrices &data) {
-    m_UniformBuffer->SetData(0, data);
+    Core::SpriteBatch::Submit(m_Texture->texture, data, m_Texture->opaque);
+}
 
-    m_Texture->Bind(UNIFORM_SURFACE_LOCATION);
-    s_Program->Bind();
-    s_Program->Validate();
+std::size_t Image::GetVariant(float maxScale) {
+    if (maxScale >= 1.0F) {
+        return 0;
+    }
+    if (maxScale >= IMAGE_DOWNSCALE_THRESHOLD || maxScale <= 0.0F) {
+        return 1;
+    }
 
-    s_VertexArray->Bind();
-    s_VertexArray->DrawTriangles();
+    // Halve while the texture stays at least as large as it is drawn
+    const auto halvings = static_cast<std::size_t>(std::log2(1.0F / maxScale));
+    return std::min(halvings + 1, TEXTURE_VARIANTS - 1);
 }
 
-void Image::InitProgram() {
-    // TODO: Create `BaseProgram` from `Program` and pass it into `Drawable`
-    s_Program =
-        std::make_unique<Core::Program>(PTSD_ASSETS_DIR "/shaders/Base.vert",
-                                        PTSD_ASSETS_DIR "/shaders/Base.frag");
-    s_Program->Bind();
+std::shared_ptr<Image::SharedTexture> Image::AcquireTexture(AssetId id,
+                                                            std::size_t variant) {
+    auto &textures = GetTextures();
+    if (id >= textures.size()) {
+        textures.resize(AssetRegistry::GetCount());
+    }
 
-    GLint location = glGetUniformLocation(s_Program->GetId(), "surface");
-    glUniform1i(location, UNIFORM_SURFACE_LOCATION);
-}
+    auto texture = textures[id][variant].lock();
+    if (texture != nullptr) {
+        s_TextureStats.hits++;
+        return texture;
+    }
+
+    CookedHeader header{};
+    std::vector<Uint8> pixels;
+    const auto &source = AssetRegistry::GetPath(id);
+    // Only downscaled variants are cooked
+    const auto cookedPath =
+        variant > 1 ? GetCookedPath(source, variant - 1) : std::string();
+    const bool cookedLoaded =
+        variant > 1 && COOKED_TEXTURE_DIR[0] != '\0' &&
+        LoadCooked(cookedPath, source, variant - 1, header, pixels);
+
+    std::shared_ptr<SDL_Surface> surface;
+    if (cookedLoaded) {
+        s_TextureStats.cookedLoads++;
+    } else {
+        surface = s_Store.Get(id);
+        header.sourceWidth = surface->w;
+        header.sourceHeight = surface->h;
+        header.opaque = Core::IsSurfaceOpaque(surface.get()) ? 1 : 0;
+    }
 
-void Image::InitVertexArray() {
-    s_VertexArray = std::make_unique<Core::VertexArray>();
-
-    // NOLINTBEGIN
-    // These are vertex data for the rectangle but clang-tidy has magic
-    // number warnings
-
-    // Vertex
-    s_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(
-        std::vector<float>{
-            -0.5F, 0.5F,  //
-            -0.5F, -0.5F, //
-            0.5F, -0.5F,  //
-            0.5F, 0.5F,   //
-        },
-        2));
-
-    // UV
-    s_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(
-        std::vector<float>{
-            0.0F, 0.0F, //
-            0.0F, 1.0F, //
-            1.0F, 1.0F, //
-            1.0F, 0.0F, //
-        },
-        2));
-
-    // Index
-    s_VertexArray->SetIndexBuffer(
-        std::make_unique<Core::IndexBuffer>(std::vector<unsigned int>{
-            0, 1, 2, //
-            0, 2, 3, //
-        }));
-    // NOLINTEND
+    if (variant > 1 && !cookedLoaded) {
+        const std::unique_ptr<SDL_Surface, void (*)(SDL_Surface *)> small(
+            Core::DownscaleSurface(surface.get(), static_cast<int>(variant - 1)),
+            SDL_FreeSurface);
+        if (small != nullptr) {
+            header.version = COOKED_VERSION;
+            header.width = small->w;
+            header.height = small->h;
+            pixels.resize(static_cast<std::size_t>(small->w) * small->h * 4);
+            for (int y = 0; y < small->h; ++y) {
+                std::memcpy(pixels.data() + static_cast<std::size_t>(y) *
+                                                small->w * 4,
+                            static_cast<const Uint8 *>(small->pixels) +
+                                static_cast<std::ptrdiff_t>(y) * small->pitch,
+                            static_cast<std::size_t>(small->w) * 4);
+            }
+            s_TextureStats.cooks++;
+            if (COOKED_TEXTURE_DIR[0] != '\0') {
+                StoreCooked(cookedPath, header, pixels);
+            }
+        }
+    }
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const glm::vec2 size(header.sourceWidth, header.sourceHeight);
+    if (!pixels.empty()) {
+        texture = std::make_shared<SharedTexture>(
+            id, variant, GL_RGBA, header.width, header.height, pixels.data(),
+            size, header.opaque != 0);
+    } else {
+        texture = std::make_shared<SharedTexture>(
+            id, variant, Core::SdlFormatToGlFormat(surface->format->format),
+            surface->w, surface->h, surface->pixels, size, header.opaque != 0);
+    }
+    s_TextureStats.uploadMs +=
+        static_cast<float>(SDL_GetPerformanceCounter() - start) * 1000.0F /
+        static_cast<float>(SDL_GetPerformanceFrequency());
+    s_TextureStats.uploads++;
+
+    textures[id][variant] = texture;
+    if (!s_KeepPixels) {
+        s_Store.Remove(id);
+    }
+    return texture;
 }
 
-std::unique_ptr<Core::Program> Image::s_Program = nullptr;
-std::unique_ptr<Core::VertexArray> Image::s_VertexArray = nullptr;
+std::vector<Image::Variants> &Image::GetTextures() {
+    // Never destroyed, images held by other statics release their texture
+    // after static destructors ran
+    static auto *textures = new std::vector<Variants>();
+    return *textures;
+}
 
-Util::AssetStore<std::shared_ptr<SDL_Surface>> Image::s_Store(LoadSurface);
+bool Image::s_KeepPixels = !RELEASE_IMAGE_PIXELS_AFTER_UPLOAD;
+Image::TextureStats Image::s_TextureStats;
+Util::AssetStore<std::shared_ptr<SDL_Surface>>
+    Image::s_Store(LoadSurface, GetSurfaceBytes, IMAGE_STORE_BUDGET_BYTES);
 } // namespace Util
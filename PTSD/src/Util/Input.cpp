@@ -12,32 +12,39 @@ SDL_Event Input::s_Event = SDL_Event();
 glm::vec2 Input::s_CursorPosition = glm::vec2(0.0F);
 glm::vec2 Input::s_ScrollDistance = glm::vec2(-1.0F, -1.0F);
 
-std::unordered_map<Keycode, std::pair<bool, bool>> Input::s_KeyState = {
-    std::make_pair(Keycode::MOUSE_LB, std::make_pair(false, false)),
-    std::make_pair(Keycode::MOUSE_RB, std::make_pair(false, false)),
-    std::make_pair(Keycode::MOUSE_MB, std::make_pair(false, false)),
-};
+std::bitset<Input::KEY_COUNT> Input::s_KeyHeld;
+std::bitset<Input::KEY_COUNT> Input::s_KeyPressed;
+std::bitset<Input::KEY_COUNT> Input::s_KeyReleased;
+std::array<Uint64, Input::KEY_COUNT> Input::s_EdgeTicks = {};
+
+EventRing<Input::KeyEvent, Input::EVENT_RING_SIZE> Input::s_EventRing;
+std::vector<Input::KeyEvent> Input::s_KeyEvents;
+std::atomic<unsigned int> Input::s_DroppedEvents{0};
+bool Input::s_Watching = false;
 
 bool Input::s_Scroll = false;
 bool Input::s_MouseMoving = false;
 bool Input::s_Exit = false;
 
-ImGuiIO Input::s_Io; // allocate memory only because it is invalid
-                     // to call `ImGui::GetIO()` at this time
-
 bool Input::IsKeyPressed(const Keycode &key) {
-
-    return s_KeyState[key].second;
+    return ToIndex(key) < KEY_COUNT && s_KeyHeld[ToIndex(key)];
 }
 
 bool Input::IsKeyDown(const Keycode &key) {
-
-    return s_KeyState[key].second && !s_KeyState[key].first;
+    return ToIndex(key) < KEY_COUNT && s_KeyPressed[ToIndex(key)];
 }
 
 bool Input::IsKeyUp(const Keycode &key) {
+    return ToIndex(key) < KEY_COUNT && s_KeyReleased[ToIndex(key)];
+}
 
-    return !s_KeyState[key].second && s_KeyState[key].first;
+float Input::GetEdgeAgeMs(const Keycode &key) {
+    if (ToIndex(key) >= KEY_COUNT || s_EdgeTicks[ToIndex(key)] == 0) {
+        return 0.0F;
+    }
+    const Uint64 ticks = SDL_GetPerformanceCounter() - s_EdgeTicks[ToIndex(key)];
+    return static_cast<float>(static_cast<double>(ticks) * 1000.0 /
+                              static_cast<double>(SDL_GetPerformanceFrequency()));
 }
 
 bool Input::IsMouseMoving() {
@@ -59,20 +66,39 @@ glm::vec2 Input::GetScrollDistance() {
     return s_ScrollDistance;
 }
 
-void Input::UpdateKeyState(const SDL_Event *event) {
-    if (event->type == SDL_MOUSEBUTTONDOWN) {
-        s_KeyState[static_cast<Keycode>(512 + event->button.button)].second =
-            true;
-    } else if (event->type == SDL_MOUSEBUTTONUP) {
-        s_KeyState[static_cast<Keycode>(512 + event->button.button)].second =
-            false;
-    } else if (event->type == SDL_KEYDOWN) {
-        s_KeyState[static_cast<Keycode>(event->key.keysym.scancode)].second =
-            true;
-    } else if (event->type == SDL_KEYUP) {
-        s_KeyState[static_cast<Keycode>(event->key.keysym.scancode)].second =
-            false;
+int Input::WatchEvent(void * /*userdata*/, SDL_Event *event) {
+    KeyEvent keyEvent{Keycode::UNKNOWN, false, SDL_GetPerformanceCounter()};
+    if (event->type == SDL_MOUSEBUTTONDOWN || event->type == SDL_MOUSEBUTTONUP) {
+        keyEvent.key = static_cast<Keycode>(512 + event->button.button);
+        keyEvent.down = event->type == SDL_MOUSEBUTTONDOWN;
+    } else if ((event->type == SDL_KEYDOWN || event->type == SDL_KEYUP) &&
+               event->key.repeat == 0) {
+        keyEvent.key = static_cast<Keycode>(event->key.keysym.scancode);
+        keyEvent.down = event->type == SDL_KEYDOWN;
+    } else {
+        return 0;
+    }
+
+    if (!s_EventRing.Push(keyEvent)) {
+        s_DroppedEvents++;
+    }
+    return 0;
+}
+
+void Input::ApplyKeyEvent(const KeyEvent &event) {
+    const std::size_t index = ToIndex(event.key);
+    if (index >= KEY_COUNT || s_KeyHeld[index] == event.down) {
+        return;
     }
+
+    s_KeyHeld[index] = event.down;
+    if (event.down) {
+        s_KeyPressed.set(index);
+    } else {
+        s_KeyReleased.set(index);
+    }
+    s_EdgeTicks[index] = event.ticks;
+    s_KeyEvents.push_back(event);
 }
 
 void Input::Update() {
@@ -87,23 +113,23 @@ void Input::Update() {
 
     s_Scroll = s_MouseMoving = false;
 
-    for (auto &[_, i] : s_KeyState) {
-        i.first = i.second;
+    s_KeyPressed.reset();
+    s_KeyReleased.reset();
+    s_KeyEvents.clear();
+
+    if (!s_Watching) {
+        SDL_AddEventWatch(WatchEvent, nullptr);
+        s_Watching = true;
     }
 
-    s_Io = ImGui::GetIO();
+    const bool imguiWantsMouse = ImGui::GetIO().WantCaptureMouse;
 
+    // Key events reach the ring through `WatchEvent` while this pumps
     while (SDL_PollEvent(&s_Event) != 0) {
-        if (s_Io.WantCaptureMouse) {
+        if (imguiWantsMouse) {
             ImGui_ImplSDL2_ProcessEvent(&s_Event);
             continue;
         }
-        if (s_Event.type == SDL_KEYDOWN || s_Event.type == SDL_KEYUP) {
-            UpdateKeyState(&s_Event);
-        } else if (s_Event.type == SDL_MOUSEBUTTONDOWN ||
-                   s_Event.type == SDL_MOUSEBUTTONUP) {
-            UpdateKeyState(&s_Event);
-        }
 
         s_Scroll = s_Event.type == SDL_MOUSEWHEEL || s_Scroll;
 
@@ -114,6 +140,14 @@ void Input::Update() {
         s_MouseMoving = s_Event.type == SDL_MOUSEMOTION || s_MouseMoving;
         s_Exit = s_Event.type == SDL_QUIT;
     }
+
+    KeyEvent event{};
+    while (s_EventRing.Pop(event)) {
+        // Same as before the ring existed, ImGui keeps what it captures
+        if (!imguiWantsMouse) {
+            ApplyKeyEvent(event);
+        }
+    }
 }
 
 glm::vec2 Input::GetCursorPosition() {
@@ -1,13 +1,80 @@
 #include "Util/Logger.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
 #include "config.hpp"
 
 namespace Util {
+namespace {
+// Messages queued for the writer thread, about 1 MiB of slots
+constexpr std::size_t QUEUE_SIZE = 8192;
+constexpr const char *PATTERN = "%n [%^%l%$] %v";
+
+std::atomic<unsigned long long> s_Messages{0};
+// Frame times only count the thread that called `Init()`
+std::thread::id s_MainThread;
+std::chrono::steady_clock::duration s_FrameTime{};
+float s_LastFrameMs = 0;
+float s_WorstFrameMs = 0;
+} // namespace
+
 void Logger::Init() {
-    spdlog::set_pattern("%n [%^%l%$] %v");
+    s_MainThread = std::this_thread::get_id();
+    spdlog::init_thread_pool(QUEUE_SIZE, 1);
+    auto sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+    // Same empty name as the default logger it replaces
+    auto logger = std::make_shared<spdlog::async_logger>(
+        "", std::move(sink), spdlog::thread_pool(),
+        spdlog::async_overflow_policy::overrun_oldest);
+    spdlog::set_default_logger(std::move(logger));
+
+    spdlog::set_pattern(PATTERN);
     SetLevel(DEFAULT_LOG_LEVEL);
 }
 
+void Logger::Shutdown() {
+    const auto level = spdlog::get_level();
+    // Writes out the queue and joins the writer thread
+    spdlog::shutdown();
+
+    // Anything logged later, from static destructors say, is written directly
+    auto logger = std::make_shared<spdlog::logger>(
+        "", std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+    logger->set_pattern(PATTERN);
+    logger->set_level(level);
+    spdlog::set_default_logger(std::move(logger));
+}
+
+void Logger::NewFrame() {
+    s_LastFrameMs =
+        std::chrono::duration<float, std::milli>(s_FrameTime).count();
+    s_WorstFrameMs = std::max(s_WorstFrameMs, s_LastFrameMs);
+    s_FrameTime = {};
+}
+
+Logger::Stats Logger::GetStats() {
+    Stats stats;
+    stats.messages = s_Messages;
+    if (auto pool = spdlog::thread_pool()) {
+        stats.dropped = pool->overrun_counter();
+    }
+    stats.lastFrameMs = s_LastFrameMs;
+    stats.worstFrameMs = s_WorstFrameMs;
+    return stats;
+}
+
+void Logger::detail::Record(std::chrono::steady_clock::duration time) {
+    ++s_Messages;
+    if (std::this_thread::get_id() == s_MainThread) {
+        s_FrameTime += time;
+    }
+}
+
 void Logger::SetLevel(Logger::Level level) {
     spdlog::set_level(static_cast<spdlog::level::level_enum>(level));
 }
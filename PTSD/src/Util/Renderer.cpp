@@ -2,6 +2,9 @@
 
 #include <queue>
 
+#include "Core/SpriteBatch.hpp"
+
+#include "Util/AllocTracker.hpp"
 #include "Util/Logger.hpp"
 
 namespace Util {
@@ -24,6 +27,8 @@ void Renderer::AddChildren(
 }
 
 void Renderer::Update() {
+    PTSD_ALLOC_SCOPE("Renderer");
+
     struct StackInfo {
         std::shared_ptr<GameObject> m_GameObject;
         Transform m_ParentTransform;
@@ -54,11 +59,18 @@ void Renderer::Update() {
         }
     }
     // draw all in render queue by order
+    m_CulledCount = 0;
     while (!renderQueue.empty()) {
         auto curr = renderQueue.top();
         renderQueue.pop();
 
+        if (curr.m_GameObject->IsOutsideWindow()) {
+            m_CulledCount++;
+            continue;
+        }
         curr.m_GameObject->Draw();
     }
+
+    Core::SpriteBatch::Flush();
 }
 } // namespace Util
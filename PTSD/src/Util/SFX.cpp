@@ -1,6 +1,8 @@
 #include "Util/SFX.hpp"
 #include "Util/Logger.hpp"
 
+#include "config.hpp"
+
 std::shared_ptr<Mix_Chunk> LoadChunk(const std::string &filepath) {
     auto chunk = std::shared_ptr<Mix_Chunk>(Mix_LoadWAV(filepath.c_str()),
                                             Mix_FreeChunk);
@@ -13,6 +15,10 @@ std::shared_ptr<Mix_Chunk> LoadChunk(const std::string &filepath) {
     return chunk;
 }
 
+std::size_t GetChunkBytes(const std::shared_ptr<Mix_Chunk> &chunk) {
+    return chunk == nullptr ? 0 : sizeof(Mix_Chunk) + chunk->alen;
+}
+
 namespace Util {
 
 SFX::SFX(const std::string &path)
@@ -48,6 +54,7 @@ void SFX::FadeIn(const unsigned int tick, const int loop,
                            static_cast<int>(duration));
 }
 
-Util::AssetStore<std::shared_ptr<Mix_Chunk>> SFX::s_Store(LoadChunk);
+Util::AssetStore<std::shared_ptr<Mix_Chunk>>
+    SFX::s_Store(LoadChunk, GetChunkBytes, SFX_STORE_BUDGET_BYTES);
 
 } // namespace Util
@@ -1,14 +1,54 @@
-// FIXME: this file should be refactor, API change reference from Image.cpp
+#include "Util/Text.hpp"
 
-#include "Core/Texture.hpp"
-#include "Core/TextureUtils.hpp"
+#include "Core/FrameUniforms.hpp"
+#include "Core/GLBackend.hpp"
+#include "Core/GPUTimer.hpp"
 
+#include "Util/AllocTracker.hpp"
 #include "Util/Logger.hpp"
-#include "Util/Text.hpp"
 #include "Util/TransformUtils.hpp"
 
 #include "config.hpp"
 
+namespace {
+/**
+ * Decodes one UTF-8 sequence starting at `i` and advances `i` past it.
+ * Malformed bytes decode to U+FFFD.
+ */
+Uint32 NextCodepoint(const std::string &text, size_t &i) {
+    constexpr Uint32 replacement = 0xFFFD;
+
+    const auto lead = static_cast<unsigned char>(text[i++]);
+    int extra = 0;
+    Uint32 codepoint = 0;
+
+    if (lead < 0x80) {
+        return lead;
+    } else if ((lead & 0xE0) == 0xC0) {
+        extra = 1;
+        codepoint = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        extra = 2;
+        codepoint = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        extra = 3;
+        codepoint = lead & 0x07;
+    } else {
+        return replacement;
+    }
+
+    for (int n = 0; n < extra; ++n) {
+        if (i >= text.size() ||
+            (static_cast<unsigned char>(text[i]) & 0xC0) != 0x80) {
+            return replacement;
+        }
+        codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[i++]) &
+                                        0x3F);
+    }
+    return codepoint;
+}
+} // namespace
+
 namespace Util {
 Text::Text(const std::string &font, int fontSize, const std::string &text,
            const Util::Color &color)
@@ -17,109 +57,150 @@ Text::Text(const std::string &font, int fontSize, const std::string &text,
     if (s_Program == nullptr) {
         InitProgram();
     }
-    if (s_VertexArray == nullptr) {
-        InitVertexArray();
-    }
-
-    m_UniformBuffer = std::make_unique<Core::UniformBuffer<Core::Matrices>>(
-        *s_Program, "Matrices", 0);
+    InitVertexArray();
 
-    m_Font = {TTF_OpenFont(font.c_str(), fontSize), TTF_CloseFont};
-
-    auto surface =
-        std::unique_ptr<SDL_Surface, std::function<void(SDL_Surface *)>>{
-            TTF_RenderUTF8_Blended_Wrapped(m_Font.get(), m_Text.c_str(),
-                                           m_Color.ToSdlColor(), 0),
-            SDL_FreeSurface,
-        };
-    if (surface == nullptr) {
-        LOG_ERROR("Failed to create text");
-        LOG_ERROR("{}", TTF_GetError());
-    }
-
-    m_Texture = std::make_unique<Core::Texture>(
-        Core::SdlFormatToGlFormat(surface->format->format),
-        surface->pitch / surface->format->BytesPerPixel, surface->h,
-        surface->pixels);
-    m_Size = {surface->pitch / surface->format->BytesPerPixel, surface->h};
+    m_Atlas = GlyphAtlas::Get(font, fontSize);
+    UpdateLayout();
 }
 
 void Text::Draw(const Core::Matrices &data) {
-    m_UniformBuffer->SetData(0, data);
+    if (m_AtlasGeneration != m_Atlas->GetGeneration()) {
+        UpdateLayout();
+    }
+    if (m_VertexArray->GetIndexBuffer().GetCount() == 0) {
+        return;
+    }
+    Core::GPUTimerScope timer("Text");
 
-    m_Texture->Bind(UNIFORM_SURFACE_LOCATION);
+    Core::FrameUniforms::Upload(data);
+
+    m_Atlas->GetTexture().Bind(UNIFORM_SURFACE_LOCATION);
     s_Program->Bind();
+    Core::GL().Uniform4f(s_ColorLocation, m_Color.r / 255.0F,
+                         m_Color.g / 255.0F, m_Color.b / 255.0F,
+                         m_Color.a / 255.0F);
     s_Program->Validate();
 
-    s_VertexArray->Bind();
-    s_VertexArray->DrawTriangles();
+    m_VertexArray->Bind();
+    m_VertexArray->DrawTriangles();
 }
 
 void Text::InitProgram() {
     // TODO: Create `BaseProgram` from `Program` and pass it into `Drawable`
     s_Program =
         std::make_unique<Core::Program>(PTSD_ASSETS_DIR "/shaders/Base.vert",
-                                        PTSD_ASSETS_DIR "/shaders/Base.frag");
+                                        PTSD_ASSETS_DIR "/shaders/Text.frag");
+    Core::FrameUniforms::Attach(*s_Program);
     s_Program->Bind();
 
-    GLint location = glGetUniformLocation(s_Program->GetId(), "surface");
-    glUniform1i(location, UNIFORM_SURFACE_LOCATION);
+    GLint location =
+        Core::GL().GetUniformLocation(s_Program->GetId(), "surface");
+    Core::GL().Uniform1i(location, UNIFORM_SURFACE_LOCATION);
+
+    s_ColorLocation =
+        Core::GL().GetUniformLocation(s_Program->GetId(), "color");
 }
 
 void Text::InitVertexArray() {
-    s_VertexArray = std::make_unique<Core::VertexArray>();
-
-    // NOLINTBEGIN
-    // These are vertex data for the rectangle but clang-tidy has magic
-    // number warnings
-
-    // Vertex
-    s_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(
-        std::vector<float>{
-            -0.5F, 0.5F,  //
-            -0.5F, -0.5F, //
-            0.5F, -0.5F,  //
-            0.5F, 0.5F,   //
-        },
-        2));
-
-    // UV
-    s_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(
-        std::vector<float>{
-            0.0F, 0.0F, //
-            0.0F, 1.0F, //
-            1.0F, 1.0F, //
-            1.0F, 0.0F, //
-        },
-        2));
-
-    // Index
-    s_VertexArray->SetIndexBuffer(
-        std::make_unique<Core::IndexBuffer>(std::vector<unsigned int>{
-            0, 1, 2, //
-            0, 2, 3, //
-        }));
-    // NOLINTEND
+    m_VertexArray = std::make_unique<Core::VertexArray>();
+
+    // Filled in by `UpdateLayout()`
+    m_VertexArray->AddVertexBuffer(
+        std::make_unique<Core::VertexBuffer>(std::vector<float>{}, 2));
+    m_VertexArray->AddVertexBuffer(
+        std::make_unique<Core::VertexBuffer>(std::vector<float>{}, 2));
+    m_VertexArray->SetIndexBuffer(
+        std::make_unique<Core::IndexBuffer>(std::vector<unsigned int>{}));
 }
 
-void Text::ApplyTexture() {
-    auto surface =
-        std::unique_ptr<SDL_Surface, std::function<void(SDL_Surface *)>>{
-            TTF_RenderUTF8_Blended_Wrapped(m_Font.get(), m_Text.c_str(),
-                                           m_Color.ToSdlColor(), 0),
-            SDL_FreeSurface,
-        };
-    if (surface == nullptr) {
-        LOG_ERROR("Failed to create text: {}", TTF_GetError());
+void Text::UpdateLayout() {
+    PTSD_ALLOC_SCOPE("Text");
+
+    std::vector<float> positions;
+    std::vector<float> uvs;
+    positions.reserve(m_Text.size() * 8);
+    uvs.reserve(m_Text.size() * 8);
+
+    // Pen position in pixels, origin at the top left, y pointing down
+    float penX = 0;
+    float penY = 0;
+    float width = 0;
+
+    // If the atlas gets cleared halfway through, the glyphs placed before
+    // that are gone, so lay the string out once more against the new atlas
+    for (int pass = 0; pass < 2; ++pass) {
+        m_AtlasGeneration = m_Atlas->GetGeneration();
+        positions.clear();
+        uvs.clear();
+        penX = 0;
+        penY = 0;
+        width = 0;
+
+        for (size_t i = 0; i < m_Text.size();) {
+            const Uint32 codepoint = NextCodepoint(m_Text, i);
+            if (codepoint == '\n') {
+                width = std::max(width, penX);
+                penX = 0;
+                penY += m_Atlas->GetLineSkip();
+                continue;
+            }
+
+            const auto *glyph = m_Atlas->GetGlyph(codepoint);
+            if (glyph == nullptr) {
+                continue;
+            }
+
+            if (glyph->size.x > 0) {
+                const float x0 = penX;
+                const float x1 = penX + glyph->size.x;
+                const float y0 = penY;
+                const float y1 = penY + glyph->size.y;
+
+                // Same winding as the `Image` quad: TL, BL, BR, TR
+                positions.insert(positions.end(),
+                                 {x0, y0, x0, y1, x1, y1, x1, y0});
+                uvs.insert(uvs.end(), {
+                                          glyph->uvMin.x, glyph->uvMin.y, //
+                                          glyph->uvMin.x, glyph->uvMax.y, //
+                                          glyph->uvMax.x, glyph->uvMax.y, //
+                                          glyph->uvMax.x, glyph->uvMin.y, //
+                                      });
+            }
+            penX += glyph->advance;
+        }
+
+        if (m_AtlasGeneration == m_Atlas->GetGeneration()) {
+            break;
+        }
+    }
+    width = std::max(width, penX);
+    const float height = penY + m_Atlas->GetHeight();
+
+    m_Size = {width, height};
+
+    // The model matrix scales a unit quad by `m_Size`, so normalize into
+    // [-0.5, 0.5] with y pointing up
+    for (size_t v = 0; v < positions.size(); v += 2) {
+        positions[v] = width > 0 ? positions[v] / width - 0.5F : 0;
+        positions[v + 1] = height > 0 ? 0.5F - positions[v + 1] / height : 0;
+    }
+
+    std::vector<unsigned int> indices;
+    const auto quads = static_cast<unsigned int>(positions.size() / 8);
+    indices.reserve(quads * 6);
+    for (unsigned int q = 0; q < quads; ++q) {
+        const unsigned int base = q * 4;
+        indices.insert(indices.end(), {base, base + 1, base + 2, //
+                                       base, base + 2, base + 3});
     }
 
-    m_Texture->UpdateData(Core::SdlFormatToGlFormat(surface->format->format),
-                          surface->pitch / surface->format->BytesPerPixel,
-                          surface->h, surface->pixels);
-    m_Size = {surface->pitch / surface->format->BytesPerPixel, surface->h};
+    m_VertexArray->Bind();
+    m_VertexArray->GetVertexBuffer(0).SetData(positions);
+    m_VertexArray->GetVertexBuffer(1).SetData(uvs);
+    m_VertexArray->GetIndexBuffer().SetData(indices);
 }
 
 std::unique_ptr<Core::Program> Text::s_Program = nullptr;
-std::unique_ptr<Core::VertexArray> Text::s_VertexArray = nullptr;
+GLint Text::s_ColorLocation = -1;
 
 } // namespace Util
@@ -5,21 +5,43 @@
 namespace Util {
 
 ms_t Time::GetElapsedTimeMs() {
-    return static_cast<float>(SDL_GetPerformanceCounter() - s_Start) /
-           static_cast<float>((SDL_GetPerformanceFrequency())) * 1000.0F;
+    // Divided as double, a float tick count already rounds after minutes
+    return static_cast<ms_t>(
+        static_cast<double>(SDL_GetPerformanceCounter() - s_Start) * 1000.0 /
+        static_cast<double>(SDL_GetPerformanceFrequency()));
+}
+
+Clock &Time::GetClock(ClockDomain domain) {
+    switch (domain) {
+    case ClockDomain::REAL:
+        return s_Real;
+    case ClockDomain::UI:
+        return s_UI;
+    case ClockDomain::GAME:
+        break;
+    }
+    return s_Game;
 }
 
 void Time::Update() {
     s_Last = s_Now;
     s_Now = SDL_GetPerformanceCounter();
 
-    s_DeltaTime = static_cast<float>(s_Now - s_Last) /
-                  static_cast<float>(SDL_GetPerformanceFrequency()) * 1000.0F;
+    const double deltaMs = static_cast<double>(s_Now - s_Last) * 1000.0 /
+                           static_cast<double>(SDL_GetPerformanceFrequency());
+    s_DeltaTime = static_cast<ms_t>(deltaMs);
+
+    s_Real.Advance(deltaMs);
+    s_Game.Advance(deltaMs);
+    s_UI.Advance(deltaMs);
 }
 
 sdl_count_t Time::s_Start = SDL_GetPerformanceCounter();
 sdl_count_t Time::s_Now = Time::s_Start;
 sdl_count_t Time::s_Last = 0;
 ms_t Time::s_DeltaTime = 0;
+Clock Time::s_Real;
+Clock Time::s_Game;
+Clock Time::s_UI;
 
 } // namespace Util
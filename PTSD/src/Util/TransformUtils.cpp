@@ -9,14 +9,18 @@ Core::Matrices ConvertToUniformBufferData(const Util::Transform &transform,
                                           const float zIndex) {
     constexpr glm::mat4 eye(1.F);
 
-    constexpr float nearClip = -100;
-    constexpr float farClip = 100;
-
-    auto projection =
-        glm::ortho<float>(0.0F, 1.0F, 0.0F, 1.0F, nearClip, farClip);
-    auto view =
-        glm::scale(eye, {1.F / WINDOW_WIDTH, 1.F / WINDOW_HEIGHT, 1.F}) *
-        glm::translate(eye, {WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2, 0});
+    // The window size is fixed, so this is only built once
+    static const glm::mat4 viewProjection = [&eye] {
+        constexpr float nearClip = -100;
+        constexpr float farClip = 100;
+
+        auto projection =
+            glm::ortho<float>(0.0F, 1.0F, 0.0F, 1.0F, nearClip, farClip);
+        auto view =
+            glm::scale(eye, {1.F / WINDOW_WIDTH, 1.F / WINDOW_HEIGHT, 1.F}) *
+            glm::translate(eye, {WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2, 0});
+        return projection * view;
+    }();
 
     // TODO: TRS comment
     auto model = glm::translate(eye, {transform.translation, zIndex}) *
@@ -25,7 +29,7 @@ Core::Matrices ConvertToUniformBufferData(const Util::Transform &transform,
 
     Core::Matrices data = {
         model,
-        projection * view,
+        viewProjection,
     };
 
     return data;
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "Util/AllocTracker.hpp"
+
+using Util::AllocTracker;
+
+#ifdef PTSD_ALLOC_TRACKING
+namespace {
+AllocTracker::TagStats FindTag(const char *name) {
+    for (std::size_t i = 0; i < AllocTracker::GetTagCount(); ++i) {
+        const auto stats = AllocTracker::GetLastFrame(i);
+        if (std::strcmp(stats.name, name) == 0) {
+            return stats;
+        }
+    }
+    return {};
+}
+} // namespace
+#endif
+
+TEST(AllocTrackerTest, ChargesAllocationsToInnermostScope) {
+#ifndef PTSD_ALLOC_TRACKING
+    GTEST_SKIP() << "Built without PTSD_ENABLE_ALLOC_TRACKING";
+#else
+    AllocTracker::NewFrame();
+    {
+        PTSD_ALLOC_SCOPE("Outer");
+        auto outer = std::make_unique<char[]>(100);
+        {
+            PTSD_ALLOC_SCOPE("Inner");
+            auto inner = std::make_unique<char[]>(30);
+            auto another = std::make_unique<char[]>(20);
+        }
+        auto again = std::make_unique<char[]>(10);
+    }
+    AllocTracker::NewFrame();
+
+    const auto outer = FindTag("Outer");
+    EXPECT_EQ(outer.count, 2);
+    EXPECT_EQ(outer.bytes, 110);
+    EXPECT_EQ(outer.liveBytes, 0);
+    EXPECT_EQ(outer.peakLiveBytes, 110);
+
+    const auto inner = FindTag("Inner");
+    EXPECT_EQ(inner.count, 2);
+    EXPECT_EQ(inner.bytes, 50);
+    EXPECT_EQ(inner.peakLiveBytes, 50);
+#endif
+}
+
+TEST(AllocTrackerTest, LiveBytesCarryOverFrames) {
+#ifndef PTSD_ALLOC_TRACKING
+    GTEST_SKIP() << "Built without PTSD_ENABLE_ALLOC_TRACKING";
+#else
+    std::unique_ptr<char[]> kept;
+    {
+        PTSD_ALLOC_SCOPE("Kept");
+        kept = std::make_unique<char[]>(64);
+    }
+    AllocTracker::NewFrame();
+    AllocTracker::NewFrame();
+
+    auto stats = FindTag("Kept");
+    EXPECT_EQ(stats.count, 0);
+    EXPECT_EQ(stats.liveBytes, 64);
+    EXPECT_EQ(stats.peakLiveBytes, 64);
+
+    // Freed outside of any scope, still charged back to the tag it came from
+    kept.reset();
+    AllocTracker::NewFrame();
+    stats = FindTag("Kept");
+    EXPECT_EQ(stats.liveBytes, 0);
+    EXPECT_EQ(stats.peakLiveBytes, 64);
+#endif
+}
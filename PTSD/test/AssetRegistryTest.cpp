@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include "Util/AssetRegistry.hpp"
+
+using Util::AssetRange;
+using Util::AssetRegistry;
+
+TEST(AssetRegistryTest, SamePathSameId) {
+    const auto id = AssetRegistry::Intern("registry/same.png");
+    EXPECT_EQ(AssetRegistry::Intern("registry/same.png"), id);
+    EXPECT_EQ(AssetRegistry::GetPath(id), "registry/same.png");
+}
+
+TEST(AssetRegistryTest, NewPathsAreConsecutive) {
+    const auto first = AssetRegistry::Intern("registry/frame_1.png");
+    const auto second = AssetRegistry::Intern("registry/frame_2.png");
+    EXPECT_EQ(second, first + 1);
+    EXPECT_EQ(AssetRegistry::GetCount(), second + 1);
+
+    const AssetRange frames{first, 2};
+    EXPECT_EQ(AssetRegistry::GetPath(frames[1]), "registry/frame_2.png");
+}
+
+TEST(AssetRegistryTest, PathsSurviveGrowth) {
+    const auto id = AssetRegistry::Intern("registry/early.png");
+    for (int i = 0; i < 1000; ++i) {
+        AssetRegistry::Intern("registry/filler_" + std::to_string(i));
+    }
+    EXPECT_EQ(AssetRegistry::Intern("registry/early.png"), id);
+    EXPECT_EQ(AssetRegistry::GetPath(id), "registry/early.png");
+}
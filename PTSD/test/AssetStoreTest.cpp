@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include "Util/AssetStore.hpp"
+
+using Util::AssetStore;
+
+namespace {
+std::shared_ptr<std::string> LoadPath(const std::string &filepath) {
+    return std::make_shared<std::string>(filepath);
+}
+
+std::size_t GetLength(const std::shared_ptr<std::string> &asset) {
+    return asset->size();
+}
+} // namespace
+
+TEST(AssetStoreTest, CountsHitsAndMisses) {
+    AssetStore<std::shared_ptr<std::string>> store(LoadPath, GetLength);
+    store.Get("a");
+    store.Get("a");
+    store.Get("bb");
+
+    EXPECT_EQ(store.GetStats().hits, 1);
+    EXPECT_EQ(store.GetStats().misses, 2);
+    EXPECT_EQ(store.GetStats().bytes, 3);
+    EXPECT_EQ(store.GetStats().entries, 2);
+}
+
+TEST(AssetStoreTest, EvictsLeastRecentlyUsed) {
+    AssetStore<std::shared_ptr<std::string>> store(LoadPath, GetLength, 4);
+    store.Get("aa");
+    store.Get("bb");
+    store.Get("aa");
+    store.Get("cc");
+
+    EXPECT_EQ(store.GetStats().evictions, 1);
+    EXPECT_EQ(store.GetStats().bytes, 4);
+
+    store.Get("aa");
+    EXPECT_EQ(store.GetStats().misses, 3);
+    store.Get("bb");
+    EXPECT_EQ(store.GetStats().misses, 4);
+}
+
+TEST(AssetStoreTest, KeepsReferencedAssets) {
+    AssetStore<std::shared_ptr<std::string>> store(LoadPath, GetLength, 2);
+    const auto held = store.Get("aa");
+    store.Get("bb");
+    store.Get("c");
+
+    // "bb" goes, "aa" is held and "c" is what was just asked for
+    EXPECT_EQ(store.GetStats().evictions, 1);
+    EXPECT_EQ(store.GetStats().entries, 2);
+    EXPECT_EQ(store.GetStats().bytes, 3);
+    EXPECT_EQ(store.Get("aa"), held);
+    EXPECT_EQ(store.GetStats().hits, 1);
+}
+
+TEST(AssetStoreTest, ShrinkingBudgetEvicts) {
+    AssetStore<std::shared_ptr<std::string>> store(LoadPath, GetLength);
+    store.Get("aa");
+    store.Get("bb");
+    store.SetBudget(2);
+
+    EXPECT_EQ(store.GetStats().bytes, 2);
+    store.Get("bb");
+    EXPECT_EQ(store.GetStats().hits, 1);
+}
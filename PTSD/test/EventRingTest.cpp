@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "Util/EventRing.hpp"
+
+using Util::EventRing;
+
+TEST(EventRingTest, PopsInPushOrder) {
+    EventRing<int, 4> ring;
+    EXPECT_TRUE(ring.Push(1));
+    EXPECT_TRUE(ring.Push(2));
+
+    int value = 0;
+    EXPECT_TRUE(ring.Pop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(ring.Pop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_FALSE(ring.Pop(value));
+}
+
+TEST(EventRingTest, FullRingRejectsPush) {
+    EventRing<int, 2> ring;
+    EXPECT_TRUE(ring.Push(1));
+    EXPECT_TRUE(ring.Push(2));
+    EXPECT_FALSE(ring.Push(3));
+    EXPECT_EQ(ring.Size(), 2);
+
+    int value = 0;
+    ring.Pop(value);
+    EXPECT_TRUE(ring.Push(3));
+    ring.Pop(value);
+    ring.Pop(value);
+    EXPECT_EQ(value, 3);
+}
+
+TEST(EventRingTest, ProducerThreadKeepsOrder) {
+    EventRing<int, 16> ring;
+    constexpr int count = 10000;
+
+    std::thread producer([&ring] {
+        for (int i = 0; i < count;) {
+            if (ring.Push(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    int value = 0;
+    while (expected < count) {
+        if (ring.Pop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
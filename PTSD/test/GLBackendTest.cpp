@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
+
+using Core::GL;
+using Core::GLBackend;
+using Core::GLBackendType;
+using Core::GLState;
+
+class GLBackendTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        GLBackend::Use(GLBackendType::NULL_DRIVER);
+        GLBackend::ResetStats();
+        GLState::Invalidate();
+    }
+};
+
+TEST_F(GLBackendTest, HandsOutDistinctNames) {
+    GLuint buffers[2] = {};
+    GL().GenBuffers(2, buffers);
+    GLuint texture = 0;
+    GL().GenTextures(1, &texture);
+
+    EXPECT_NE(buffers[0], 0U);
+    EXPECT_NE(buffers[0], buffers[1]);
+    EXPECT_NE(texture, buffers[1]);
+}
+
+TEST_F(GLBackendTest, CountsElidedBindsOnce) {
+    GLState::UseProgram(3);
+    GLState::UseProgram(3);
+    GLState::BindTexture(0, 7);
+
+    // `BindTexture` switches the active unit first
+    EXPECT_EQ(GLBackend::GetStats().binds, 3U);
+    EXPECT_EQ(GLBackend::GetStats().calls, 3U);
+}
+
+TEST_F(GLBackendTest, CountsUploadedBytes) {
+    const std::vector<unsigned char> pixels(4 * 4 * 4);
+    GL().TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 4, 4, 0, GL_RGBA,
+                    GL_UNSIGNED_BYTE, pixels.data());
+    GL().BufferData(GL_ARRAY_BUFFER, 100, pixels.data(), GL_STATIC_DRAW);
+    // Allocation only, nothing is uploaded
+    GL().BufferData(GL_ARRAY_BUFFER, 100, nullptr, GL_STATIC_DRAW);
+
+    EXPECT_EQ(GLBackend::GetStats().uploads, 3U);
+    EXPECT_EQ(GLBackend::GetStats().uploadedBytes, 64U + 100U);
+}
+
+TEST_F(GLBackendTest, CountsDrawsAndUniforms) {
+    GL().Uniform1f(0, 1.0F);
+    GL().Uniform4f(0, 1.0F, 1.0F, 1.0F, 1.0F);
+    GL().DrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+    GL().DrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, 10);
+
+    EXPECT_EQ(GLBackend::GetStats().uniforms, 2U);
+    EXPECT_EQ(GLBackend::GetStats().draws, 2U);
+}
+
+TEST_F(GLBackendTest, ReportsSuccessfulBuilds) {
+    const GLuint shader = GL().CreateShader(GL_VERTEX_SHADER);
+    GLint status = GL_FALSE;
+    GL().GetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    EXPECT_EQ(status, GL_TRUE);
+
+    const GLuint program = GL().CreateProgram();
+    status = GL_FALSE;
+    GL().GetProgramiv(program, GL_LINK_STATUS, &status);
+    EXPECT_EQ(status, GL_TRUE);
+
+    // Callers fall back to their unmapped path
+    EXPECT_EQ(GL().MapBufferRange(GL_UNIFORM_BUFFER, 0, 16, GL_MAP_WRITE_BIT),
+              nullptr);
+}
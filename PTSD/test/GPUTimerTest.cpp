@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "Core/GLBackend.hpp"
+#include "Core/GPUTimer.hpp"
+
+using Core::GLBackend;
+using Core::GLBackendType;
+using Core::GPUTimer;
+using Core::GPUTimerScope;
+
+class GPUTimerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        GLBackend::Use(GLBackendType::NULL_DRIVER);
+        GPUTimer::SetEnabled(true);
+        // Drain frames left in flight by other tests
+        for (std::size_t i = 0; i < GPUTimer::FRAMES_IN_FLIGHT; ++i) {
+            GPUTimer::NewFrame();
+        }
+        GPUTimer::ResetStats();
+    }
+
+    void TearDown() override { GPUTimer::SetEnabled(false); }
+
+    static bool HasPass(const char *name) {
+        for (std::size_t i = 0; i < GPUTimer::GetPassCount(); ++i) {
+            if (std::strcmp(GPUTimer::GetPassName(i), name) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+TEST_F(GPUTimerTest, ScopesResumeTheInterruptedPass) {
+    {
+        GPUTimerScope outer("Outer");
+        EXPECT_STREQ(GPUTimer::GetCurrentPass(), "Outer");
+        {
+            GPUTimerScope inner("Inner");
+            EXPECT_STREQ(GPUTimer::GetCurrentPass(), "Inner");
+        }
+        EXPECT_STREQ(GPUTimer::GetCurrentPass(), "Outer");
+    }
+    EXPECT_EQ(GPUTimer::GetCurrentPass(), nullptr);
+    EXPECT_TRUE(HasPass("Outer"));
+    EXPECT_TRUE(HasPass("Inner"));
+}
+
+TEST_F(GPUTimerTest, ReadsFramesBackTwoFramesLater) {
+    {
+        GPUTimerScope timer("Pass");
+    }
+    GPUTimer::NewFrame();
+    GPUTimer::NewFrame();
+    EXPECT_EQ(GPUTimer::GetStats().frames, 0U);
+
+    GPUTimer::NewFrame();
+    EXPECT_EQ(GPUTimer::GetStats().frames, 1U);
+    EXPECT_EQ(GPUTimer::GetStats().late, 0U);
+}
+
+TEST_F(GPUTimerTest, DropsPiecesPastTheQueryBudget) {
+    // Each round takes three queries, A, B and A again
+    for (std::size_t i = 0; i < GPUTimer::MAX_QUERIES / 3 + 1; ++i) {
+        GPUTimerScope a("A");
+        GPUTimerScope b("B");
+    }
+    GPUTimer::NewFrame();
+    EXPECT_EQ(GPUTimer::GetStats().dropped, 2U);
+}
+
+TEST_F(GPUTimerTest, DisabledTimerTimesNothing) {
+    GPUTimer::SetEnabled(false);
+    {
+        GPUTimerScope timer("Disabled");
+        EXPECT_EQ(GPUTimer::GetCurrentPass(), nullptr);
+    }
+    EXPECT_FALSE(HasPass("Disabled"));
+}
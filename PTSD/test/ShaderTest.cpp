@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+
+#include "Core/Shader.hpp"
+
+using Core::Shader;
+
+TEST(ShaderTest, NoDefinesKeepsSource) {
+    const std::string src = "#version 410 core\nvoid main() {}\n";
+    EXPECT_EQ(Shader::InjectDefines(src, {}), src);
+}
+
+TEST(ShaderTest, DefinesFollowVersion) {
+    EXPECT_EQ(Shader::InjectDefines("#version 410 core\nvoid main() {}\n",
+                                    {"HOLLOW", "GLOW"}),
+              "#version 410 core\n#define HOLLOW\n#define GLOW\nvoid main() {}\n");
+}
+
+TEST(ShaderTest, DefinesFollowIndentedVersion) {
+    EXPECT_EQ(Shader::InjectDefines(" #version 410 core\r\nvoid main() {}\n",
+                                    {"SPECIALIZED"}),
+              " #version 410 core\r\n#define SPECIALIZED\nvoid main() {}\n");
+}
+
+TEST(ShaderTest, DefinesFollowVersionAfterComments) {
+    EXPECT_EQ(Shader::InjectDefines("\xEF\xBB\xBF// Header\n/* a\nb */\n"
+                                    "#version 410 core\nvoid main() {}\n",
+                                    {"GLOW"}),
+              "\xEF\xBB\xBF// Header\n/* a\nb */\n#version 410 core\n"
+              "#define GLOW\nvoid main() {}\n");
+}
+
+TEST(ShaderTest, DefinesWithoutVersion) {
+    EXPECT_EQ(Shader::InjectDefines("void main() {}\n", {"GLOW"}),
+              "#define GLOW\nvoid main() {}\n");
+}
@@ -2,23 +2,50 @@
 
 in vec2 v_TexCoord;
 
+// 修飾器模式，與 Circle.frag 相同
+#ifdef SPECIALIZED
+    #ifdef FILL_HOLLOW
+        #define FILL_TYPE 1
+    #else
+        #define FILL_TYPE 0
+    #endif
+    #if defined(EDGE_GLOW)
+        #define EDGE_TYPE 2
+    #elif defined(EDGE_DARK)
+        #define EDGE_TYPE 1
+    #else
+        #define EDGE_TYPE 0
+    #endif
+    #if defined(ANIM_TRAIL)
+        #define ANIM_TYPE 2
+    #elif defined(ANIM_RIPPLE)
+        #define ANIM_TYPE 1
+    #else
+        #define ANIM_TYPE 0
+    #endif
+#else
+    uniform int u_FillType;     // 0=實心, 1=空心
+    uniform int u_EdgeType;     // 0=無邊緣效果, 1=邊緣加深, 2=邊緣發光
+    uniform int u_AnimType;     // 0=無動畫, 1=波紋, 2=尾跡
+    #define FILL_TYPE u_FillType
+    #define EDGE_TYPE u_EdgeType
+    #define ANIM_TYPE u_AnimType
+#endif
+
 // 基本參數
 uniform vec2 u_Radii;       // 橢圓的x和y半徑
 uniform vec4 u_Color;       // 橢圓的基本顏色
 uniform float u_Time;       // 用於動畫效果
 
 // 填充修飾器參數
-uniform int u_FillType;     // 0=實心, 1=空心
 uniform float u_Thickness;  // 空心時的線條粗細
 uniform float u_FillThickness; // 替代名稱，用於兼容性 (與 u_Thickness 相同)
 
 // 邊緣修飾器參數
-uniform int u_EdgeType;     // 0=無邊緣效果, 1=邊緣加深, 2=邊緣發光
 uniform float u_EdgeWidth;  // 邊緣寬度
 uniform vec4 u_EdgeColor;   // 邊緣顏色
 
 // 動畫修飾器參數
-uniform int u_AnimType;     // 0=無動畫, 1=波紋, 2=尾跡
 uniform float u_Intensity;  // 效果強度
 uniform float u_AnimSpeed;  // 效果速度
 
@@ -34,12 +61,12 @@ void main() {
 
     // 波紋動畫效果
     float animEffect = 0.0;
-    if (u_AnimType == 1) { // 波紋效果
+    if (ANIM_TYPE == 1) { // 波紋效果
         animEffect = u_Intensity * 0.1 * sin(u_Time * u_AnimSpeed * 3.0);
     }
 
     // 填充類型處理
-    if (u_FillType == 0) { // 實心
+    if (FILL_TYPE == 0) { // 實心
         ellipse = 1.0 - smoothstep(1.0 + animEffect - 0.01, 1.0 + animEffect, dist);
     } else { // 空心
         float inner = 1.0 - u_Thickness / min(u_Radii.x, u_Radii.y);
@@ -57,9 +84,9 @@ void main() {
     vec4 finalColor = u_Color;
 
     // 邊緣效果
-    if (u_EdgeType > 0) {
+    if (EDGE_TYPE > 0) {
         float edge = 0.0;
-        if (u_FillType == 0) { // 實心的邊緣
+        if (FILL_TYPE == 0) { // 實心的邊緣
             edge = smoothstep(1.0 + animEffect - u_EdgeWidth, 1.0 + animEffect, dist);
         } else { // 空心的邊緣
             float inner = 1.0 - u_Thickness / min(u_Radii.x, u_Radii.y);
@@ -71,16 +98,16 @@ void main() {
             edge = innerEdge * (1.0 - outerEdge);
         }
 
-        if (u_EdgeType == 1) { // 邊緣加深
+        if (EDGE_TYPE == 1) { // 邊緣加深
             finalColor = mix(finalColor, vec4(0.0, 0.0, 0.0, finalColor.a), edge * 0.7);
-        } else if (u_EdgeType == 2) { // 邊緣發光
+        } else if (EDGE_TYPE == 2) { // 邊緣發光
             finalColor = mix(finalColor, u_EdgeColor, edge);
             finalColor.rgb *= 1.0 + edge * 2.0; // 讓邊緣更亮
         }
     }
 
     // 尾跡效果
-    if (u_AnimType == 2) { // 尾跡效果
+    if (ANIM_TYPE == 2) { // 尾跡效果
         vec2 direction = vec2(1.0, 0.0); // 假設向右
         float trail = smoothstep(0.0, 0.5, dot(normalize(v_TexCoord), -direction) * 0.5 + 0.5) *
                     (1.0 - dist / (1.0 + animEffect));
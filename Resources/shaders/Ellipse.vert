@@ -3,8 +3,11 @@
 layout(location = 0) in vec2 position;
 layout(location = 1) in vec2 texCoord;
 
-uniform Matrices {
+layout(std140) uniform Model {
     mat4 model;
+};
+
+layout(std140) uniform Camera {
     mat4 projection;
 };
 
@@ -2,15 +2,16 @@
 
 layout(location = 0) in vec2 a_Position;
 layout(location = 1) in vec2 a_TexCoord;
+layout(location = 2) in vec3 a_Bar;    // 每條血條：位置 (xy) 與寬度比例 (z)
+layout(location = 3) in vec4 a_Color;  // 每條血條的顏色
 
 out vec2 v_TexCoord;
-
-uniform float u_Width;
-uniform vec2 u_Position;  // 新增血條位置
+out vec4 v_Color;
 
 void main() {
-    gl_Position = vec4(u_Position.x + a_Position.x * u_Width,
-                       u_Position.y + a_Position.y,
+    gl_Position = vec4(a_Bar.x + a_Position.x * a_Bar.z,
+                       a_Bar.y + a_Position.y,
                        0.0, 1.0);
     v_TexCoord = a_TexCoord;
+    v_Color = a_Color;
 }
@@ -0,0 +1,41 @@
+#version 410 core
+
+in vec2 v_TexCoord;
+
+uniform vec2 u_Size;        // 四邊形大小 (像素)
+uniform float u_Radius;     // 環的半徑 (像素)
+uniform float u_DotRadius;  // 每個點的半徑 (像素)
+uniform int u_Segments;     // 環上的點數
+uniform int u_Lit;          // 亮著的點數，從 0 度開始逆時針計算
+uniform vec4 u_Color;       // 點的顏色
+
+out vec4 fragColor;
+
+const float TWO_PI = 6.28318530718;
+
+void main() {
+    // 轉成以中心為原點、y 軸朝上的像素座標
+    vec2 p = vec2(v_TexCoord.x, -v_TexCoord.y) * u_Size;
+
+    // 找出角度上最接近的點
+    float segmentAngle = TWO_PI / float(u_Segments);
+    float angle = atan(p.y, p.x);
+    if (angle < 0.0) {
+        angle += TWO_PI;
+    }
+    float index = mod(floor(angle / segmentAngle + 0.5), float(u_Segments));
+
+    // 血量不足的點不畫
+    if (index >= float(u_Lit)) {
+        discard;
+    }
+
+    vec2 center = u_Radius * vec2(cos(index * segmentAngle), sin(index * segmentAngle));
+    float alpha = 1.0 - smoothstep(u_DotRadius - 1.0, u_DotRadius, distance(p, center));
+
+    if (alpha < 0.01) {
+        discard;
+    }
+
+    fragColor = vec4(u_Color.rgb, u_Color.a * alpha);
+}
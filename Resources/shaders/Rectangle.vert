@@ -1,16 +1,30 @@
- #version 410 core
+#version 410 core
 
  layout(location = 0) in vec2 position;
  layout(location = 1) in vec2 texCoord;
 
- uniform Matrices {
+ layout(std140) uniform Model {
      mat4 model;
+ };
+
+ layout(std140) uniform Camera {
      mat4 projection;
  };
 
+ uniform float u_Rotation;     // 矩形的旋轉角度 (弧度)
+
  out vec2 v_TexCoord;
 
+ // 應用旋轉到坐標
+ vec2 rotate2D(vec2 coord, float angle) {
+     float s = sin(angle);
+     float c = cos(angle);
+     mat2 rotMat = mat2(c, -s, s, c);
+     return rotMat * coord;
+ }
+
  void main() {
      gl_Position = projection * model * vec4(position, 0.0, 1.0);
-     v_TexCoord = texCoord - vec2(0.5, 0.5); // 將UV坐標移到中心
+     // 旋轉是線性的，每個頂點算一次即可，不必每個片段都算 sin/cos
+     v_TexCoord = rotate2D(texCoord - vec2(0.5, 0.5), u_Rotation); // 將UV坐標移到中心再旋轉
  }
\ No newline at end of file
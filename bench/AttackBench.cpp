@@ -0,0 +1,79 @@
+#include "BenchContext.hpp"
+
+#include "AssetManifest.hpp"
+#include "Attack/AttackManager.hpp"
+#include "Attack/AttackPattern.hpp"
+#include "Attack/CircleAttack.hpp"
+#include "Attack/RectangleAttack.hpp"
+
+#include <memory>
+
+namespace {
+    constexpr float FRAME_SECONDS = 1.0f / 60.0f;
+    // 測試期間不會走完的持續時間
+    constexpr float FOREVER = 1e9f;
+
+    // 推進到 ATTACKING 並停在那裡，每幀都會做碰撞判斷
+    template <typename T>
+    std::shared_ptr<T> MakeAttacking(std::shared_ptr<T> attack) {
+        attack->SetAttackDuration(FOREVER);
+        attack->Update(0.0f);  // CREATED -> WARNING
+        attack->Update(0.5f);  // WARNING -> COUNTDOWN
+        attack->Update(0.5f);  // COUNTDOWN -> ATTACKING
+        return attack;
+    }
+
+    // 圓形與矩形攻擊各半，玩家在場外，判斷到底但不會受傷
+    void BM_AttackManagerUpdate(benchmark::State& state) {
+        auto& manager = AttackManager::GetInstance();
+        manager.ClearAllAttacks();
+
+        const auto count = static_cast<int>(state.range(0));
+        for (int i = 0; i < count; ++i) {
+            const glm::vec2 position(static_cast<float>(i % 16) * 80.0f - 600.0f,
+                                     static_cast<float>(i / 16) * 40.0f - 300.0f);
+            if (i % 2 == 0) {
+                manager.RegisterAttack(MakeAttacking(std::make_shared<CircleAttack>(position, 0.6f)));
+            } else {
+                manager.RegisterAttack(MakeAttacking(std::make_shared<RectangleAttack>(
+                    position, 0.6f, RectangleAttack::Direction::HORIZONTAL)));
+            }
+        }
+
+        auto player = std::make_shared<Character>(Asset::Get(Asset::ImageSet::RABBIT_IDLE));
+        player->SetPosition({10000.0f, 10000.0f});
+
+        Bench::ResetGLCounters();
+        for (auto _ : state) {
+            manager.Update(FRAME_SECONDS, player);
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+        Bench::ReportGLCounters(state);
+        manager.ClearAllAttacks();
+    }
+    BENCHMARK(BM_AttackManagerUpdate)->RangeMultiplier(4)->Range(16, 256);
+
+    // 攻擊都排在測試結束之後才開始，量的是每幀掃描時間表的成本
+    // 開始後的攻擊交給 AttackManager，已經在上面量過
+    void BM_AttackPatternUpdate(benchmark::State& state) {
+        const auto count = static_cast<int>(state.range(0));
+        AttackPattern pattern;
+        for (int i = 0; i < count; ++i) {
+            pattern.AddAttack(std::make_shared<CircleAttack>(glm::vec2(0.0f), 1.0f),
+                              FOREVER + static_cast<float>(i));
+            pattern.AddEnemyMovement([](std::shared_ptr<Enemy>, float) {},
+                                     FOREVER + static_cast<float>(i));
+        }
+        pattern.SetDuration(2.0f * FOREVER);
+
+        std::shared_ptr<Enemy> enemy;
+        std::shared_ptr<Character> player;
+        pattern.Start(enemy);
+
+        for (auto _ : state) {
+            pattern.Update(FRAME_SECONDS, player);
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+    BENCHMARK(BM_AttackPatternUpdate)->RangeMultiplier(4)->Range(16, 256);
+}
@@ -0,0 +1,16 @@
+#ifndef BENCH_CONTEXT_HPP
+#define BENCH_CONTEXT_HPP
+
+#include <benchmark/benchmark.h>
+
+// 基準測試共用的工具
+namespace Bench {
+    // 在計時迴圈前呼叫，歸零 GL 呼叫計數
+    void ResetGLCounters();
+
+    // 在計時迴圈後呼叫，把每次迭代平均的 GL 呼叫數寫進結果
+    // 只有 null driver 會計數，--native-gl 時全部為 0
+    void ReportGLCounters(benchmark::State& state);
+}
+
+#endif // BENCH_CONTEXT_HPP
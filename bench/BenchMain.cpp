@@ -0,0 +1,115 @@
+#include "BenchContext.hpp"
+
+#include "AssetManifest.hpp"
+#include "Core/GLBackend.hpp"
+#include "Effect/EffectManager.hpp"
+
+#include "Util/Logger.hpp"
+
+#include "config.hpp"
+
+#include <cstring>
+
+namespace {
+    constexpr const char* NATIVE_GL_FLAG = "--native-gl";
+
+    // 與 Core::Context 相同的 GL 版本，但視窗保持隱藏，也不跑遊戲迴圈
+    // 不用 Core::Context，它會顯示視窗並開啟音效裝置
+    bool CreateHiddenContext() {
+        if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+            LOG_ERROR("Failed to initialize SDL: {}", SDL_GetError());
+            return false;
+        }
+
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 1);
+
+        SDL_Window* window = SDL_CreateWindow("RabbitAndSteelBench", SDL_WINDOWPOS_UNDEFINED,
+                                              SDL_WINDOWPOS_UNDEFINED, WINDOW_WIDTH, WINDOW_HEIGHT,
+                                              SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+        if (window == nullptr) {
+            LOG_ERROR("Failed to create hidden window: {}", SDL_GetError());
+            return false;
+        }
+        if (SDL_GL_CreateContext(window) == nullptr) {
+            LOG_ERROR("Failed to create GL context: {}", SDL_GetError());
+            return false;
+        }
+
+        glewExperimental = GL_TRUE;
+        if (glewInit() != GLEW_OK) {
+            LOG_ERROR("Failed to initialize GLEW");
+            return false;
+        }
+        return true;
+    }
+
+    // 取出自己的參數，其餘交給 benchmark::Initialize
+    bool TakeFlag(int& argc, char** argv, const char* flag) {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], flag) == 0) {
+                for (int j = i; j + 1 < argc; ++j) {
+                    argv[j] = argv[j + 1];
+                }
+                --argc;
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+void Bench::ResetGLCounters() {
+    Core::GLBackend::ResetStats();
+}
+
+void Bench::ReportGLCounters(benchmark::State& state) {
+    const auto& stats = Core::GLBackend::GetStats();
+    const auto perIteration = [](unsigned long long value) {
+        return benchmark::Counter(static_cast<double>(value), benchmark::Counter::kAvgIterations);
+    };
+    state.counters["gl_binds"] = perIteration(stats.binds);
+    state.counters["gl_uploads"] = perIteration(stats.uploads);
+    state.counters["gl_uploaded_bytes"] = perIteration(stats.uploadedBytes);
+    state.counters["gl_uniforms"] = perIteration(stats.uniforms);
+    state.counters["gl_draws"] = perIteration(stats.draws);
+}
+
+// 用法：
+//   RabbitAndSteelBench --benchmark_out=baseline.json --benchmark_out_format=json
+// 兩份 JSON 可以用 Google Benchmark 附的 tools/compare.py 比較
+//
+// 預設走 PTSD 的 null driver，不需要視窗或顯示卡，量到的是送出繪圖的 CPU 成本
+// 加上 --native-gl 改在隱藏視窗的 GL context 上跑，連驅動程式的成本一起量
+int main(int argc, char** argv) {
+    Util::Logger::Init();
+    // 建立角色、特效時的 INFO 訊息會混進結果，只留警告以上
+    Util::Logger::SetLevel(Util::Logger::Level::WARN);
+
+    const bool nativeGl = TakeFlag(argc, argv, NATIVE_GL_FLAG);
+    if (nativeGl && CreateHiddenContext()) {
+        Core::GLBackend::Use(Core::GLBackendType::NATIVE);
+    } else {
+        if (nativeGl) {
+            LOG_WARN("No GL context, using the null driver");
+        }
+        Core::GLBackend::Use(Core::GLBackendType::NULL_DRIVER);
+    }
+    TTF_Init();
+
+    Asset::Load();
+    Effect::EffectManager::GetInstance().Initialize(10);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        Util::Logger::Shutdown();
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    // 貼圖、著色器由靜態的資源快取持有，context 留到行程結束，不在這裡刪除
+    Util::Logger::Shutdown();
+    return 0;
+}
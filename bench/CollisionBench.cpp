@@ -0,0 +1,87 @@
+#include "BenchContext.hpp"
+
+#include "AssetManifest.hpp"
+#include "Attack/RectangleAttack.hpp"
+#include "Character.hpp"
+
+#include "config.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+    // 2 的次方，迴圈中以遮罩輪流取用
+    constexpr std::size_t TARGET_COUNT = 64;
+
+    // 固定種子、散布在整個畫面的角色，碰撞結果有真有假，分支不會被預測成同一邊
+    std::vector<std::shared_ptr<Character>> MakeTargets() {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> x(-WINDOW_WIDTH / 2.0f, WINDOW_WIDTH / 2.0f);
+        std::uniform_real_distribution<float> y(-WINDOW_HEIGHT / 2.0f, WINDOW_HEIGHT / 2.0f);
+
+        std::vector<std::shared_ptr<Character>> targets;
+        targets.reserve(TARGET_COUNT);
+        for (std::size_t i = 0; i < TARGET_COUNT; ++i) {
+            auto target = std::make_shared<Character>(Asset::Get(Asset::ImageSet::TRAINING_DUMMY));
+            target->SetPosition({x(rng), y(rng)});
+            targets.push_back(target);
+        }
+        return targets;
+    }
+
+    template <typename Collide>
+    void RunCollision(benchmark::State& state, Collide collide) {
+        const Character player(Asset::Get(Asset::ImageSet::RABBIT_IDLE));
+        const auto targets = MakeTargets();
+
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(collide(player, targets[i]));
+            i = (i + 1) & (TARGET_COUNT - 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_CharacterIfCollideCircle(benchmark::State& state) {
+        RunCollision(state, [](const Character& player, const std::shared_ptr<Character>& target) {
+            return player.IfCollideCircle(target, 100.0f);
+        });
+    }
+    BENCHMARK(BM_CharacterIfCollideCircle);
+
+    void BM_CharacterIfCollideSweptCircle(benchmark::State& state) {
+        RunCollision(state, [](const Character& player, const std::shared_ptr<Character>& target) {
+            return player.IfCollideSweptCircle(target);
+        });
+    }
+    BENCHMARK(BM_CharacterIfCollideSweptCircle);
+
+    void BM_CharacterIfCollideEllipse(benchmark::State& state) {
+        RunCollision(state, [](const Character& player, const std::shared_ptr<Character>& target) {
+            return player.IfCollideEllipse(target);
+        });
+    }
+    BENCHMARK(BM_CharacterIfCollideEllipse);
+
+    // IsPointInRectangle 是私有的，CheckCollisionInternal 只是把角色位置轉給它
+    class ProbeRectangleAttack : public RectangleAttack {
+    public:
+        using RectangleAttack::RectangleAttack;
+        using RectangleAttack::CheckCollisionInternal;
+    };
+
+    // 斜向光束，旋轉與多邊形判斷都會走到
+    void BM_RectangleAttackIsPointInRectangle(benchmark::State& state) {
+        ProbeRectangleAttack attack({0.0f, 0.0f}, 1.0f, RectangleAttack::Direction::DIAGONAL_TL_BR);
+        const auto targets = MakeTargets();
+
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(attack.CheckCollisionInternal(targets[i]));
+            i = (i + 1) & (TARGET_COUNT - 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_RectangleAttackIsPointInRectangle);
+}
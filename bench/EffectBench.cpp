@@ -0,0 +1,42 @@
+#include "BenchContext.hpp"
+
+#include "Effect/EffectManager.hpp"
+
+#include <cstdint>
+#include <iterator>
+
+namespace {
+    constexpr float FRAME_SECONDS = 1.0f / 60.0f;
+
+    // 各種特效輪流播放，持續時間夠長，測試期間都不會回收進物件池
+    void BM_EffectManagerUpdate(benchmark::State& state) {
+        constexpr Effect::EffectType types[] = {
+            Effect::EffectType::SKILL_Z,
+            Effect::EffectType::SKILL_X,
+            Effect::EffectType::SKILL_C,
+            Effect::EffectType::SKILL_V,
+            Effect::EffectType::ENEMY_ATTACK_2,
+            Effect::EffectType::RECT_LASER,
+            Effect::EffectType::RECT_BEAM,
+        };
+
+        auto& manager = Effect::EffectManager::GetInstance();
+        manager.ClearAllEffects();
+
+        const auto count = static_cast<std::size_t>(state.range(0));
+        for (std::size_t i = 0; i < count; ++i) {
+            const glm::vec2 position(static_cast<float>(i % 16) * 80.0f - 600.0f,
+                                     static_cast<float>(i / 16) * 40.0f - 300.0f);
+            manager.PlayEffect(types[i % std::size(types)], position, 0.0f, 1e9f);
+        }
+
+        Bench::ResetGLCounters();
+        for (auto _ : state) {
+            manager.Update(FRAME_SECONDS);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+        Bench::ReportGLCounters(state);
+        manager.ClearAllEffects();
+    }
+    BENCHMARK(BM_EffectManagerUpdate)->RangeMultiplier(4)->Range(16, 256);
+}
@@ -0,0 +1,132 @@
+#include "BenchContext.hpp"
+
+#include "AssetManifest.hpp"
+
+#include "Util/AssetStore.hpp"
+#include "Util/GameObject.hpp"
+#include "Util/Image.hpp"
+#include "Util/Renderer.hpp"
+
+#include "config.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    // 沒有 Drawable 的物件 Draw() 直接返回，SpriteBatch 也沒有東西可送
+    // 量到的是走訪子樹與依 z-index 排序的成本，不需要 GL
+    void BM_RendererUpdate(benchmark::State& state) {
+        constexpr std::size_t ROOT_COUNT = 8;
+        constexpr std::size_t FAN_OUT = 4;
+
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> zIndex(0.0f, 100.0f);
+
+        const auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<std::shared_ptr<Util::GameObject>> nodes;
+        nodes.reserve(count);
+        Util::Renderer renderer;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto node = std::make_shared<Util::GameObject>(nullptr, zIndex(rng));
+            if (i < ROOT_COUNT) {
+                renderer.AddChild(node);
+            } else {
+                nodes[(i - ROOT_COUNT) / FAN_OUT]->AddChild(node);
+            }
+            nodes.push_back(node);
+        }
+
+        for (auto _ : state) {
+            renderer.Update();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+    BENCHMARK(BM_RendererUpdate)->RangeMultiplier(4)->Range(64, 4096);
+
+    // 整條繪圖路徑：走訪、Image::Draw、SpriteBatch 排序與送出，GL 呼叫數一併記錄
+    // 兩種圖片交錯出現，批次需要切換貼圖
+    void BM_RendererSubmitSprites(benchmark::State& state) {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> x(-WINDOW_WIDTH / 2.0f, WINDOW_WIDTH / 2.0f);
+        std::uniform_real_distribution<float> y(-WINDOW_HEIGHT / 2.0f, WINDOW_HEIGHT / 2.0f);
+        std::uniform_real_distribution<float> zIndex(0.0f, 100.0f);
+
+        const std::shared_ptr<Core::Drawable> images[] = {
+            std::make_shared<Util::Image>(Asset::Get(Asset::ImageSet::RABBIT_IDLE)[0]),
+            std::make_shared<Util::Image>(Asset::Get(Asset::ImageSet::TRAINING_DUMMY)[0]),
+        };
+
+        const auto count = static_cast<std::size_t>(state.range(0));
+        Util::Renderer renderer;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto object = std::make_shared<Util::GameObject>(images[i % 2], zIndex(rng));
+            object->m_Transform.translation = {x(rng), y(rng)};
+            object->m_Transform.scale = {0.25f, 0.25f};
+            renderer.AddChild(object);
+        }
+
+        Bench::ResetGLCounters();
+        for (auto _ : state) {
+            renderer.Update();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+        Bench::ReportGLCounters(state);
+    }
+    BENCHMARK(BM_RendererSubmitSprites)->RangeMultiplier(4)->Range(64, 4096);
+
+    constexpr std::size_t ASSET_COUNT = 256;
+
+    std::vector<std::string> MakeAssetPaths() {
+        std::vector<std::string> paths;
+        paths.reserve(ASSET_COUNT);
+        for (std::size_t i = 0; i < ASSET_COUNT; ++i) {
+            paths.push_back("bench/asset_" + std::to_string(i) + ".png");
+        }
+        return paths;
+    }
+
+    // 載入器不碰檔案，只量快取命中時的查詢與 LRU 更新
+    using IntStore = Util::AssetStore<std::shared_ptr<int>>;
+
+    std::shared_ptr<int> LoadInt(const std::string&) {
+        return std::make_shared<int>(0);
+    }
+
+    void BM_AssetStoreGetById(benchmark::State& state) {
+        const auto paths = MakeAssetPaths();
+        IntStore store(LoadInt);
+        std::vector<Util::AssetId> ids;
+        for (const auto& path : paths) {
+            ids.push_back(Util::AssetRegistry::Intern(path));
+            store.Load(ids.back());
+        }
+
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(store.Get(ids[i]));
+            i = (i + 1) & (ASSET_COUNT - 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_AssetStoreGetById);
+
+    // 以路徑查詢，多了一次 AssetRegistry::Intern 的雜湊
+    void BM_AssetStoreGetByPath(benchmark::State& state) {
+        const auto paths = MakeAssetPaths();
+        IntStore store(LoadInt);
+        for (const auto& path : paths) {
+            store.Load(path);
+        }
+
+        std::size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(store.Get(paths[i]));
+            i = (i + 1) & (ASSET_COUNT - 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_AssetStoreGetByPath);
+}
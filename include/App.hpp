@@ -4,6 +4,7 @@
 #include "pch.hpp"
 
 #include "Util/Renderer.hpp"
+#include "Util/Keycode.hpp"
 #include "Character.hpp"
 #include "Enemy.hpp"
 #include "PhaseManger.hpp"
@@ -12,7 +13,9 @@
 #include "SkillUI.hpp"
 #include "HealthBarUI.hpp"
 #include "LevelUI.hpp"
+#include "HealthBarOverlay.hpp"
 #include "ShopUI.hpp"
+#include "Telemetry.hpp"
 #include "Effect/EffectManager.hpp"
 #include "Attack/EnemyAttackController.hpp"
 #include "Attack/AttackManager.hpp"
@@ -42,6 +45,10 @@ public:
 
     void End();
 
+    // 效能疊加層 (GPU 各 pass 時間、配置統計)，F3 切換，需在 Context::Setup 與 Update 之間呼叫
+    void DrawDebugOverlay() const;
+    [[nodiscard]] bool IsDebugOverlayShown() const { return m_ShowDebugOverlay; }
+
     void AddToRoot(const std::shared_ptr<Util::GameObject> &object) {
         m_Root.AddChild(object);
     }
@@ -62,6 +69,10 @@ private:
     void SetupTreasurePhase() const;      // 設置寶箱關卡配置
     void SetupBattlePhase() const;      // 設置戰鬥關卡配置
     void RestartGame();
+    void RecordHudTime(Uint64 counts);  // 累計 HUD 更新時間，定期輸出平均值
+    void RecordEnemyUpdate(Uint64 counts, int liveEnemies, int ringDraws);  // 累計敵人更新時間與血條環 draw call，隨 draw 統計輸出
+    void ReportDrawStats(const char* screen);  // 定期輸出上一幀的 draw call 數量
+    void RecordInputLatency(Util::Keycode key);  // 累計按鍵到技能生效的延遲
 
     App() {}
 
@@ -84,28 +95,36 @@ private:
     std::shared_ptr<LevelUI> m_LevelUI;                // 角色等級UI
     std::shared_ptr<ShopUI> m_shopUI;                  // 商店UI
     std::shared_ptr<Util::GameObject> m_Overlay;
+    std::unique_ptr<HealthBarOverlay> m_HealthBarOverlay;  // 敵人血條 HUD 疊加層
 
-    bool m_EnterDown = false;
-    bool m_ZKeyDown = false;
-    bool m_XKeyDown = false;
-    bool m_CKeyDown = false;
-    bool m_VKeyDown = false;
     float m_TestEffectTimer = 0.0f;
 
-    bool m_NKeyDown = false;
-    bool m_RKeyDown = false;
-    bool m_UpKeyDown = false;
-    bool m_DownKeyDown = false;
-    bool m_LeftKeyDown = false;
-    bool m_RightKeyDown = false;
     std::shared_ptr<Enemy> m_Onward;
     std::shared_ptr<Enemy> m_GetReady;
     std::shared_ptr<Enemy> m_PressZtoJoin;
     bool m_IsReady = false;
     int m_CurrentPausedOption = 0;
-    bool m_GKeyDown = false;
-    bool m_HKeyDown = false;  // 用於偵測 H 鍵按下狀態
     bool m_CheatMode = false;  // 作弊模式標誌
+    bool m_ShowDebugOverlay = false;  // 是否顯示效能疊加層
+
+    // HUD 每幀 CPU 時間統計
+    static constexpr int HUD_TIMING_FRAMES = 300;
+    double m_HudTimeMs = 0.0;
+    double m_HudPeakMs = 0.0;
+    int m_HudFrames = 0;
+    int m_DrawStatsFrames = 0;
+
+    // 敵人每幀更新時間與血條環 draw call，以存活敵人數平均
+    double m_EnemyUpdateMs = 0.0;
+    int m_EnemyFrames = 0;  // 各幀存活敵人數的總和
+    int m_EnemyRingDraws = 0;
+
+    // 按鍵放開 (SDL 收到事件) 到技能生效之間的延遲統計
+    double m_InputLatencyMs = 0.0;
+    double m_InputLatencyPeakMs = 0.0;
+    int m_InputLatencyCount = 0;
+
+    Telemetry m_Telemetry;  // 本次遊玩的效能統計，End 時寫出報告
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef ASSET_MANIFEST_HPP
+#define ASSET_MANIFEST_HPP
+
+#include "Util/AssetRegistry.hpp"
+
+#include <cstdint>
+
+// 遊戲資源清單：啟動時依序登記所有圖片集，同一集的圖片取得連號 ID，
+// 之後以 Util::AssetRange 傳遞，查詢改為陣列索引而不必再雜湊路徑
+namespace Asset {
+    enum class ImageSet : std::uint8_t {
+        RABBIT_IDLE,
+        RABBIT_HURT,
+        RABBIT_SKILL_Z,  // C 鍵技能共用同一組動畫
+        RABBIT_SKILL_X,
+        RABBIT_SKILL_V,
+
+        TRAINING_DUMMY,
+        MOUSE_PALADIN,
+        MOUSE_ROSEMAGE,
+        MOUSE_COMMANDER,
+        DRAGON_GOLD,
+        DRAGON_MYTHRIL,
+        DRAGON_SILVER,
+        BIRD_STUDENT,
+        BIRD_WHISPERING,
+        BIRD_VALEDICTORIAN,
+        SHOPKEEPER,
+        TREASURE,
+
+        ONWARD,
+        GET_READY,
+        PRESS_Z_TO_JOIN,
+
+        COUNT
+    };
+
+    // 登記清單中的所有圖片，重複呼叫會得到相同的 ID
+    void Load();
+
+    // 圖片集的 ID 範圍，必須先呼叫 Load
+    Util::AssetRange Get(ImageSet set);
+}
+
+#endif // ASSET_MANIFEST_HPP
@@ -30,6 +30,8 @@ public:
     void Draw() override;
 
     [[nodiscard]] bool IsFinished() const { return m_State == State::FINISHED; }
+    // 攻擊離開畫面而在持續時間結束前就被結束
+    [[nodiscard]] bool WasDespawnedEarly() const { return m_DespawnedEarly; }
     State GetState() const { return m_State; }
 
     bool CheckCollision(const std::shared_ptr<Character>& character);
@@ -81,6 +83,7 @@ protected:
 
     State m_State = State::CREATED;
     bool m_IsFirstUpdate = true;
+    bool m_DespawnedEarly = false;
     glm::vec2 m_Position;
     float m_Delay;
     float m_ElapsedTime = 0.0f;
@@ -24,11 +24,14 @@ public:
     void Update(float deltaTime, std::shared_ptr<Character> &player);
     void ClearAllAttacks();
     size_t GetActiveAttacksCount() const { return m_ActiveAttacks.size(); }
+    // 累計因離開畫面而提前移除的攻擊數
+    unsigned int GetEarlyDespawnCount() const { return m_EarlyDespawns; }
 
 private:
     AttackManager() = default;
 
     std::vector<std::shared_ptr<Attack>> m_ActiveAttacks;
+    unsigned int m_EarlyDespawns = 0;
 };
 
 #endif // ATTACKMANAGER_HPP
\ No newline at end of file
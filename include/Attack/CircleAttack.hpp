@@ -31,6 +31,7 @@ protected:
     void SyncWithEffect() override;
     void OnCountdownStart() override;
     void OnAttackStart() override;
+    void OnAttackUpdate(float deltaTime) override;
 
 private:
     float m_Radius;
@@ -4,10 +4,11 @@
 #include "Util/GameObject.hpp"
 #include "Util/Animation.hpp"
 #include "Skill.hpp"
+#include "Observable.hpp"
 
 class Character : public Util::GameObject {
 public:
-    explicit Character(const std::vector<std::string>& ImageSet);
+    explicit Character(Util::AssetRange ImageSet);
     enum class State {
         IDLE,
         USING_SKILL,
@@ -19,36 +20,48 @@ public:
     Character& operator=(const Character&) = delete;
     Character& operator=(Character&&) = delete;
 
-    [[nodiscard]] const std::vector<std::string>& GetImagePathSet() const { return m_ImagePathSet; }
+    [[nodiscard]] Util::AssetRange GetImageSet() const { return m_ImageSet; }
     [[nodiscard]] const glm::vec2& GetPosition() const { return m_Transform.translation; }
     [[nodiscard]] bool GetVisibility() const { return m_Visible; }
-    [[nodiscard]] int GetLevel() const { return m_Level; }
-    [[nodiscard]] int GetMoney() const { return m_Money; }
-    [[nodiscard]] int GetExperience() const { return m_Experience; }
+    [[nodiscard]] int GetLevel() const { return m_Level.Get(); }
+    [[nodiscard]] int GetMoney() const { return m_Money.Get(); }
+    [[nodiscard]] int GetExperience() const { return m_Experience.Get(); }
 
     void UpdateLevel();
-    void AddExperience(const int experience){ m_Experience += experience; }
-    void AddMoney(const int money){ m_Money += money; }
+    void AddExperience(const int experience){ m_Experience.Set(m_Experience.Get() + experience); }
+    void AddMoney(const int money){ m_Money.Set(m_Money.Get() + money); }
+
+    // 可觀察屬性，HUD 訂閱後只在數值改變時更新
+    [[nodiscard]] const Observable<int>& HealthProperty() const { return m_Health; }
+    [[nodiscard]] const Observable<int>& LevelProperty() const { return m_Level; }
+    [[nodiscard]] const Observable<int>& MoneyProperty() const { return m_Money; }
+    [[nodiscard]] const Observable<int>& ExperienceProperty() const { return m_Experience; }
+    [[nodiscard]] const Observable<glm::vec2>& PositionProperty() const { return m_PositionProperty; }
+    [[nodiscard]] const Observable<bool>& VisibilityProperty() const { return m_VisibilityProperty; }
+    [[nodiscard]] const Observable<bool>& SkillXProperty() const { return m_SkillXProperty; }
+    // 技能剩餘冷卻，以顯示用的整數秒發布 (0 表示冷卻完畢)；skillId 須先以 AddSkill 加入
+    [[nodiscard]] const Observable<int>& CooldownProperty(const int skillId) const { return m_CooldownSeconds.at(skillId); }
 
     bool IfCollide(const std::shared_ptr<Character>& other, float Distance) const;
     bool IfCollideCircle(const std::shared_ptr<Character>& other, float Distance) const;
     bool IfCollideSweptCircle(const std::shared_ptr<Character>& other) const;
     bool IfCollideEllipse(const std::shared_ptr<Character>& other) const;
 
-    void SetPosition(const glm::vec2& Position) { m_Transform.translation = Position; }
+    void SetPosition(const glm::vec2& Position) { m_Transform.translation = Position; PublishState(); }
+    void SetVisible(bool visible) override;
     void SetInversion() { m_Transform.scale.x *= -1; } // 設定左右反轉角色
 
     void TowardNearestEnemy(const std::vector<std::shared_ptr<Character>>& m_Enemies, bool isMove); // 朝向最近的敵人
 
     // 技能
-    void AddSkill(int skillId, const std::vector<std::string>& skillImageSet,
+    void AddSkill(int skillId, Util::AssetRange skillImageSet,
                  int duration = 175, float Cooldown = 2.0f);
     bool UseSkill(int skillId, const std::vector<std::shared_ptr<Character>>& m_Enemies);  // 1=Z, 2=X, 3=C, 4=V
     void ResetSkill();
 
     virtual void Update();
     virtual void Reset();
-    void UpdateSkillXUes(const int skillId) { m_IsSkillXUes = skillId==2 ? true : false; }
+    void UpdateSkillXUes(const int skillId) { m_IsSkillXUes = skillId==2 ? true : false; m_SkillXProperty.Set(m_IsSkillXUes); }
     [[nodiscard]] bool IsSkillXUes() const { return m_IsSkillXUes; }
 
     bool IsSkillOnCooldown(int skillId) const;
@@ -67,19 +80,19 @@ public:
     // 血量相關
     void TakeDamage(int damage = 1);
     bool IsInvincible() const { return m_Invincible; }
-    int GetHealth() const { return m_Health; }
+    int GetHealth() const { return m_Health.Get(); }
     int GetMaxHealth() const { return m_MaxHealth; }
     void SetMaxHealth(int maxHealth);
-    bool IsAlive() const { return m_Health > 0; }
+    bool IsAlive() const { return m_Health.Get() > 0; }
 
-    void AddHurtAnimation(const std::vector<std::string>& hurtImageSet, int duration = 500);
+    void AddHurtAnimation(Util::AssetRange hurtImageSet, int duration = 500);
 
     void ToggleGodMode();
     bool IsInGodMode() const { return m_GodMode; }
 
 protected:
     // 為子類提供的方法
-    void SetImagePathSet(const std::vector<std::string>& newImageSet) { m_ImagePathSet = newImageSet; }
+    void SetImageSet(const Util::AssetRange newImageSet) { m_ImageSet = newImageSet; }
     void SetIdleAnimation(const std::shared_ptr<Util::Animation> &animation) { m_IdleAnimation = animation; }
     std::shared_ptr<Util::Animation> GetIdleAnimation() const { return m_IdleAnimation; }
 
@@ -88,8 +101,10 @@ private:
     void SwitchToIdle();
     void SwitchToSkill(int skillId);
     void SwitchToHurt();    // 切換到受傷狀態
+    // 把每幀才會變動的狀態 (位置、可見度、冷卻) 寫進可觀察屬性
+    void PublishState();
 
-    std::vector<std::string> m_ImagePathSet;
+    Util::AssetRange m_ImageSet;
     std::shared_ptr<Util::Animation> m_IdleAnimation;
     std::shared_ptr<Util::Animation> m_HurtAnimation;  // 受傷動畫
 
@@ -104,7 +119,7 @@ private:
     std::shared_ptr<Skill> m_CurrentSkill = nullptr;
 
     // 血量相關屬性
-    int m_Health = 100;          // 當前血量
+    Observable<int> m_Health{100}; // 當前血量
     int m_MaxHealth = 100;       // 最大血量
     bool m_Invincible = false; // 是否處於無敵狀態
     float m_InvincibleTimer = 0.0f; // 無敵時間計時器
@@ -121,9 +136,14 @@ private:
     glm::vec2 m_TargetPosition = glm::vec2(0.0f, 0.0f);
     glm::vec2 m_MoveSpeed = glm::vec2(0.0f, 0.0f);
 
-    int m_Money = 0;
-    int m_Experience = 0;
-    int m_Level = 1;
+    Observable<int> m_Money{0};
+    Observable<int> m_Experience{0};
+    Observable<int> m_Level{1};
+
+    Observable<glm::vec2> m_PositionProperty;
+    Observable<bool> m_VisibilityProperty{true};
+    Observable<bool> m_SkillXProperty{false};
+    std::unordered_map<int, Observable<int>> m_CooldownSeconds;
     bool m_GodMode = false;
 };
 
@@ -5,6 +5,7 @@
 #include "Character.hpp"
 #include "Object.hpp"
 #include "TextObject.hpp"
+#include "Observable.hpp"
 
 #include <string>
 #include <sstream>
@@ -22,7 +23,7 @@ public:
 
     [[nodiscard]] bool GetVisibility() const{ return m_IfVisible; }
 
-    [[nodiscard]] float GetGameTimer() const{ return m_GameTimer; }
+    [[nodiscard]] double GetGameTimer() const{ return m_GameTimer; }
 
     void Switch (bool isLeft);
 
@@ -51,13 +52,16 @@ private:
 
     std::vector<std::shared_ptr<Object>> m_Options;
     int m_CurrentOption = 0;
-    float m_GameTimer = 0.0f;
+    double m_GameTimer = 0.0;  // 遊戲時鐘累計毫秒，float 長時間累加會失準
     bool m_IsGameStart = false;
 
     std::vector<std::shared_ptr<Object>> m_PassedPhases;
     std::vector<int> m_PassedLevels;
 
-    static std::string StringGameTime(const float gameTime = 0) {
+    bool m_LevelDirty = true; // 角色等級改變時設定，Get() 才重設文字
+    std::vector<Connection> m_Connections; // 比 m_Character 先解構
+
+    static std::string StringGameTime(const double gameTime = 0) {
         const int totalMilliseconds = static_cast<int>(gameTime * 10); // 轉換成1/10豪秒的單位
         const int dms = totalMilliseconds % 10000;
         const int totalSeconds = totalMilliseconds / 10000;
@@ -29,6 +29,10 @@ namespace Effect {
         );
 
         size_t GetActiveEffectsCount() const { return m_ActiveEffects.size(); }
+        // 上一次 Draw 因為完全在畫面外而略過的特效數
+        unsigned int GetCulledCount() const { return m_CulledCount; }
+        // 物件池沒有閒置特效、必須新建的次數 (累計)
+        unsigned int GetPoolMissCount() const { return m_PoolMisses; }
         void ClearAllEffects() {
             for (auto& effect : m_ActiveEffects) {
                 if (effect) {
@@ -42,6 +46,8 @@ namespace Effect {
         EffectManager() : Util::GameObject(nullptr, 30.0f) {}
         std::unordered_map<EffectType, std::queue<std::shared_ptr<CompositeEffect>>> m_InactiveEffects;
         std::vector<std::shared_ptr<CompositeEffect>> m_ActiveEffects;
+        unsigned int m_CulledCount = 0;
+        unsigned int m_PoolMisses = 0;
     };
 }
 
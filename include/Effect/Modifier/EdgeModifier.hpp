@@ -15,14 +15,12 @@ namespace Effect {
         public:
             EdgeModifier(EdgeType type = EdgeType::NONE, float width = 0.05f, const Util::Color& edgeColor = Util::Color::FromName(Util::Colors::PINK));
             void Apply(Core::Program& program);
+            // 對應的著色器特化位元
+            Shape::Variant::Mask GetVariant() const;
         private:
             EdgeType m_EdgeType;
             float m_Width;
             Util::Color m_EdgeColor;
-
-            GLint m_EdgeTypeLocation = -1;
-            GLint m_EdgeWidthLocation = -1;
-            GLint m_EdgeColorLocation = -1;
         };
 
     }
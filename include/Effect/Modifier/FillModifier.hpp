@@ -15,12 +15,11 @@ namespace Effect {
         public:
             FillModifier(FillType type = FillType::SOLID, float thickness = 0.02f);
             void Apply(Core::Program& program);
+            // 對應的著色器特化位元
+            Shape::Variant::Mask GetVariant() const;
         private:
             FillType m_FillType;
             float m_Thickness;
-
-            GLint m_FillTypeLocation = -1;
-            GLint m_ThicknessLocation = -1;
         };
 
     }
@@ -3,13 +3,25 @@
 
 #include "Effect/IEffect.hpp"
 #include "Core/Program.hpp"
+#include "Core/ProgramVariants.hpp"
 #include "Core/VertexArray.hpp"
-#include "Core/UniformBuffer.hpp"
 #include "Util/Color.hpp"
 
 namespace Effect {
     namespace Shape {
 
+        // 形狀著色器特化版本的位元，依序對應 BaseShape::MakeVariants 注入的 #define
+        namespace Variant {
+            using Mask = Core::ProgramVariants::Mask;
+
+            constexpr Mask SPECIALIZED = 1u << 0;  // 未設定時為依 uniform 分支的 uber shader
+            constexpr Mask FILL_HOLLOW = 1u << 1;
+            constexpr Mask EDGE_DARK = 1u << 2;
+            constexpr Mask EDGE_GLOW = 1u << 3;
+            constexpr Mask ANIM_RIPPLE = 1u << 4;  // 目前沒有修飾器會設定動畫位元
+            constexpr Mask ANIM_TRAIL = 1u << 5;
+        }
+
         class BaseShape : public IEffect {
         public:
             BaseShape(float duration = 1.0f);
@@ -25,14 +37,31 @@ namespace Effect {
             void SetUserData(int data) { m_UserData = data; }
             int GetUserData() const { return m_UserData; }
 
+            // 綁定 variant 對應的著色程式 (第一次使用時才編譯)，之後的 Draw 都用它
+            Core::Program& UseVariant(Variant::Mask variant);
+
+            // 改用 uber shader，用來和特化版本比較片段著色成本
+            static void SetUseUberShader(bool enable) { s_UseUberShader = enable; }
+            static bool IsUsingUberShader() { return s_UseUberShader; }
+
         protected:
             Util::Color m_Color = Util::Color::FromName(Util::Colors::PINK);
             virtual void InitializeResources() = 0;
+            virtual Core::ProgramVariants& GetVariants() = 0;
+
+            // 建立形狀著色器的 variant 快取
+            static std::unique_ptr<Core::ProgramVariants> MakeVariants(const std::string& vertexPath,
+                                                                       const std::string& fragmentPath);
+
+            // 目前使用的著色程式，尚未選擇時為 nullptr
+            Core::Program* m_Program = nullptr;
 
         private:
             int m_UserData = -1;
+
+            static bool s_UseUberShader;
         };
     }
 }
 
-#endif
\ No newline at end of file
+#endif
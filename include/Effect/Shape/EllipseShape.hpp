@@ -19,21 +19,15 @@ namespace Effect {
 
             void SetSize(const glm::vec2& size) { m_Size = size; }
 
-            static Core::Program* GetProgram() { return s_Program.get(); }
             static Core::VertexArray* GetVertexArray() { return s_VertexArray.get(); }
 
         protected:
             void InitializeResources() override;
+            Core::ProgramVariants& GetVariants() override { return *s_Variants; }
 
-            static std::unique_ptr<Core::Program> s_Program;
+            static std::unique_ptr<Core::ProgramVariants> s_Variants;
             static std::unique_ptr<Core::VertexArray> s_VertexArray;
 
-            std::unique_ptr<Core::UniformBuffer<Core::Matrices>> m_MatricesBuffer;
-
-            GLint m_RadiiLocation = -1;
-            GLint m_ColorLocation = -1;
-            GLint m_TimeLocation = -1;
-
             glm::vec2 m_Radii = {0.4f, 0.3f}; // 橢圓的x和y半徑
             glm::vec2 m_Size = {400, 400};    // 效果的大小
         };
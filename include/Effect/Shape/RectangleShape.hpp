@@ -39,23 +39,15 @@ namespace Effect {
 
             void SetSize(const glm::vec2& size) { m_Size = size; }
 
-            static Core::Program* GetProgram() { return s_Program.get(); }
             static Core::VertexArray* GetVertexArray() { return s_VertexArray.get(); }
 
         protected:
             void InitializeResources() override;
+            Core::ProgramVariants& GetVariants() override { return *s_Variants; }
 
-            static std::unique_ptr<Core::Program> s_Program;
+            static std::unique_ptr<Core::ProgramVariants> s_Variants;
             static std::unique_ptr<Core::VertexArray> s_VertexArray;
 
-            std::unique_ptr<Core::UniformBuffer<Core::Matrices>> m_MatricesBuffer;
-
-            GLint m_DimensionsLocation = -1;
-            GLint m_ThicknessLocation = -1;
-            GLint m_RotationLocation = -1;
-            GLint m_ColorLocation = -1;
-            GLint m_TimeLocation = -1;
-
             glm::vec2 m_Dimensions = {0.8f, 0.1f};
             float m_Thickness = 0.03f;
             float m_Rotation = 0.0f;
@@ -5,13 +5,16 @@
 #include "Util/Renderer.hpp"
 #include "Util/Time.hpp"
 #include "Util/Animation.hpp"
+#include "HealthRing.hpp"
 
-#include <set>
+#include <map>
+
+class HealthBarOverlay;
 
 // Enemy 類別，繼承自 Character，代表遊戲中的敵人角色
 class Enemy : public Character {
 public:
-    Enemy(std::string name, float health, const std::vector<std::string>& ImageSet);    // 構造函數，初始化敵人的血量與影像集
+    Enemy(std::string name, float health, Util::AssetRange ImageSet);    // 構造函數，初始化敵人的血量與影像集
 
     [[nodiscard]] bool IfAlive() const{ return m_Health > 0.0f; }   // 檢查敵人是否仍然存活
 
@@ -28,10 +31,10 @@ public:
     [[nodiscard]] std::string& GetName() { return m_Name; }
 
     // 新增：切換敵人圖片集的函數
-    void SwitchImageSet(const std::vector<std::string>& newImageSet);
+    void SwitchImageSet(Util::AssetRange newImageSet);
     void SwitchImageSetByIndex(int imageSetIndex);
-    void AddImageSetCollection(const std::vector<std::vector<std::string>>& imageSets);
-    void SetImageSetCollection(int index, const std::vector<std::string>& imageSet);
+    void AddImageSetCollection(const std::vector<Util::AssetRange>& imageSets);
+    void SetImageSetCollection(int index, Util::AssetRange imageSet);
     [[nodiscard]] int GetCurrentImageSetIndex() const { return m_CurrentImageSetIndex; }
     [[nodiscard]] size_t GetImageSetCollectionSize() const { return m_ImageSetCollection.size(); }
 
@@ -40,31 +43,23 @@ public:
     void Update() override;
     void Reset() override;
 
-    static std::set<float> s_HealthBarYPositions;
-    void DrawHealthBar(const glm::vec2& position = glm::vec2 (0.9f, 0.9)) const;    // 繪製敵人的血條
+    // 把血條登記到 HUD 疊加層，回傳敵人是否仍在場上 (可見)
+    bool SubmitHealthBar(HealthBarOverlay& overlay, const glm::vec2& anchor = glm::vec2 (0.9f, 0.9)) const;
 
     void InitHealthRing();
     void UpdateHealthRing();
     void SetShowHealthRing(bool show) { m_ShowHealthRing = show; }
     bool GetShowHealthRing() const { return m_ShowHealthRing; }
 private:
-
-    static void InitProgram();  // 初始化著色程序（Shader Program）
-    static void InitVertexArray();  // 初始化頂點陣列（Vertex Array Object）
-    void InitUniforms();    // 初始化 Uniform 變數（著色器中的全域變數）
-
     // 重建動畫的私有函數
-    void RebuildAnimation(const std::vector<std::string>& newImageSet);
-
-    static std::unique_ptr<Core::Program> s_Program;    // 靜態成員變數：共享的著色程序
-    static std::unique_ptr<Core::VertexArray> s_VertexArray;    // 靜態成員變數：共享的頂點數據
+    void RebuildAnimation(Util::AssetRange newImageSet);
 
     std::string m_Name;
     float m_Health;
     float m_MaxHealth;
 
-    // 圖片集管理
-    std::vector<std::vector<std::string>> m_ImageSetCollection;
+    // 圖片集管理，索引為 關卡*100+子關卡，只存有用到的索引
+    std::map<int, Util::AssetRange> m_ImageSetCollection;
     int m_CurrentImageSetIndex = 0;
 
     bool m_IsMoving = false;
@@ -75,13 +70,10 @@ private:
     glm::vec2 m_Direction = glm::vec2(0.0f, 0.0f);
     glm::vec2 m_TargetPosition = glm::vec2(0.0f, 0.0f);
 
-    // Uniform 變數位置（顏色與血條寬度）
-    GLint m_ColorLocation;
-    GLint m_WidthLocation;
-
     bool m_ShowHealthRing = false;  // 是否顯示血條環
     std::shared_ptr<Util::GameObject> m_HealthRingBackground;  // 半透明背景
-    std::vector<std::shared_ptr<Util::GameObject>> m_HealthDots;  // 血條點
+    std::shared_ptr<HealthRing> m_HealthRing;  // 點狀血條，整圈一次繪製
+    std::shared_ptr<Util::GameObject> m_HealthRingObject;
     int m_TotalDots = 80;  // 環形血條上的點數量
     float m_RingRadius = 150.0f;  // 環形半徑
 };
@@ -0,0 +1,38 @@
+#ifndef HEALTH_BAR_OVERLAY_HPP
+#define HEALTH_BAR_OVERLAY_HPP
+
+#include "Core/Program.hpp"
+#include "Core/VertexArray.hpp"
+
+#include <memory>
+#include <vector>
+
+// 敵人血條的 HUD 疊加層
+// Update 時由敵人登記血條，渲染樹畫完後以一次 instanced draw 全部畫出
+class HealthBarOverlay {
+public:
+    HealthBarOverlay();
+
+    // 登記一條血條 (anchor 為 NDC 座標，血條往左延伸)
+    // 同一幀內的多條血條依登記順序往下堆疊
+    void Submit(const glm::vec2& anchor, float fill, const glm::vec4& color);
+
+    // 在渲染樹之後呼叫，畫完後清空本幀登記的血條
+    void Draw();
+
+    [[nodiscard]] size_t GetCount() const { return m_Bars.size() / 3; }
+
+private:
+    void InitProgram();  // 初始化著色程序
+    void InitVertexArray();  // 初始化血條四邊形與每條血條的屬性緩衝
+
+    static constexpr float STACK_SPACING = 0.05f;  // 堆疊時每條血條的間距
+
+    std::unique_ptr<Core::Program> m_Program;
+    std::unique_ptr<Core::VertexArray> m_VertexArray;
+
+    std::vector<float> m_Bars;  // 每條血條：x, y, 寬度比例
+    std::vector<float> m_Colors;  // 每條血條：r, g, b, a
+};
+
+#endif // HEALTH_BAR_OVERLAY_HPP
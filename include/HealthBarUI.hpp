@@ -4,6 +4,7 @@
 #include "Util/GameObject.hpp"
 #include "Character.hpp"
 #include "Object.hpp"
+#include "Observable.hpp"
 #include <memory>
 #include <string>
 #include <vector>
@@ -42,6 +43,11 @@ private:
     static constexpr int MAX_HEALTH_BARS = 3;
 
     std::vector<std::shared_ptr<Object>> m_HealthBars; // 血條圖片
+
+    // 角色屬性改變時設定，Update() 只處理被標記的部分
+    bool m_VisibilityDirty = true;
+    bool m_HealthDirty = true;
+    std::vector<Connection> m_Connections; // 放在最後，比 m_Character 先解構
 };
 
 #endif // HEALTH_BAR_UI_HPP
\ No newline at end of file
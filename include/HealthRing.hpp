@@ -0,0 +1,46 @@
+#ifndef HEALTH_RING_HPP
+#define HEALTH_RING_HPP
+
+#include "Core/Drawable.hpp"
+#include "Core/Program.hpp"
+#include "Core/VertexArray.hpp"
+
+#include <memory>
+
+// 環形點狀血條，整圈只畫一個四邊形，點的位置與亮暗都在片段著色器裡算
+class HealthRing : public Core::Drawable {
+public:
+    explicit HealthRing(float radius = 150.0f, int segments = 80, float dotRadius = 2.5f);
+
+    void Draw(const Core::Matrices& data) override;
+    [[nodiscard]] glm::vec2 GetSize() const override { return m_Size; }
+
+    // 剩餘血量比例 (0~1)，換算成亮著的點數
+    void SetFill(float fill);
+    [[nodiscard]] int GetLitSegments() const { return m_LitSegments; }
+
+    void SetColor(const glm::vec4& color) { m_Color = color; }
+
+private:
+    static void InitProgram();  // 初始化著色程序
+    static void InitVertexArray();  // 初始化共用的四邊形
+
+    static std::unique_ptr<Core::Program> s_Program;
+    static std::unique_ptr<Core::VertexArray> s_VertexArray;
+
+    static GLint s_SizeLocation;
+    static GLint s_RadiusLocation;
+    static GLint s_DotRadiusLocation;
+    static GLint s_SegmentsLocation;
+    static GLint s_LitLocation;
+    static GLint s_ColorLocation;
+
+    float m_Radius;
+    int m_Segments;
+    float m_DotRadius;
+    int m_LitSegments;
+    glm::vec2 m_Size;
+    glm::vec4 m_Color = {1.0f, 0.5f, 0.5f, 1.0f};  // 與原本 healthPoint.png 相同的顏色
+};
+
+#endif // HEALTH_RING_HPP
@@ -5,6 +5,7 @@
 #include "Character.hpp"
 #include "Object.hpp"
 #include "TextObject.hpp"
+#include "Observable.hpp"
 #include <memory>
 #include <string>
 #include <vector>
@@ -45,6 +46,13 @@ private:
 
     float baseX = -1;
     float baseY = -1;
+
+    // 角色屬性改變時設定，Update() 只處理被標記的部分
+    bool m_VisibilityDirty = true;
+    bool m_LevelDirty = false;
+    bool m_MoneyDirty = false;
+    bool m_ExperienceDirty = false;
+    std::vector<Connection> m_Connections; // 放在最後，比 m_Character 先解構
 };
 
 #endif // LEVEL_UI_HPP
\ No newline at end of file
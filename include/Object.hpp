@@ -5,7 +5,8 @@
 
 class Object : public Util::GameObject {
 public:
-    explicit Object(const std::string& ImagePath);
+    // maxScale 為最大顯示縮放，小於 1 時改用縮小並附 mipmap 的貼圖
+    explicit Object(const std::string& ImagePath, float maxScale = 1.0f);
 
     Object(const Object&) = delete;
     Object(Object&&) = delete;
@@ -33,6 +34,7 @@ private:
     void ResetPosition() { m_Transform.translation = {0, 0}; }
 
     std::string m_ImagePath;
+    float m_MaxScale = 1.0f;
 
     bool m_IsMoving = false;
     float m_DistanceTraveled = 0.0f;
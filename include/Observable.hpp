@@ -0,0 +1,91 @@
+#ifndef OBSERVABLE_HPP
+#define OBSERVABLE_HPP
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+// 訂閱的生命週期，解構時自動取消訂閱
+class Connection {
+public:
+    Connection() = default;
+    explicit Connection(std::function<void()> disconnect) : m_Disconnect(std::move(disconnect)) {}
+
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+
+    Connection(Connection&& other) noexcept : m_Disconnect(std::move(other.m_Disconnect)) {
+        other.m_Disconnect = nullptr;
+    }
+    Connection& operator=(Connection&& other) noexcept {
+        if (this != &other) {
+            Disconnect();
+            m_Disconnect = std::move(other.m_Disconnect);
+            other.m_Disconnect = nullptr;
+        }
+        return *this;
+    }
+
+    ~Connection() { Disconnect(); }
+
+    void Disconnect() {
+        if (m_Disconnect) {
+            m_Disconnect();
+            m_Disconnect = nullptr;
+        }
+    }
+
+private:
+    std::function<void()> m_Disconnect;
+};
+
+// 可觀察的屬性：值真的改變時才通知訂閱者
+// 訂閱者通常只設定自己的 dirty flag，真正的更新留到 Update() 再做
+template <typename T>
+class Observable {
+public:
+    using Listener = std::function<void(const T&)>;
+
+    Observable() = default;
+    explicit Observable(T value) : m_Value(std::move(value)) {}
+
+    // 訂閱者以 this 指向這裡，不能被複製或搬移
+    Observable(const Observable&) = delete;
+    Observable(Observable&&) = delete;
+    Observable& operator=(const Observable&) = delete;
+    Observable& operator=(Observable&&) = delete;
+
+    [[nodiscard]] const T& Get() const { return m_Value; }
+
+    void Set(const T& value) {
+        if (m_Value == value) return;
+        m_Value = value;
+        // 以索引走訪，回呼中新增訂閱也不會讓迭代器失效
+        for (size_t i = 0; i < m_Listeners.size(); ++i) {
+            m_Listeners[i].second(m_Value);
+        }
+    }
+
+    // 回傳的 Connection 必須比 Observable 先解構
+    [[nodiscard]] Connection Subscribe(Listener listener) const {
+        const int id = ++m_NextId;
+        m_Listeners.emplace_back(id, std::move(listener));
+        return Connection([this, id] { Unsubscribe(id); });
+    }
+
+private:
+    void Unsubscribe(const int id) const {
+        for (auto it = m_Listeners.begin(); it != m_Listeners.end(); ++it) {
+            if (it->first == id) {
+                m_Listeners.erase(it);
+                return;
+            }
+        }
+    }
+
+    T m_Value{};
+    mutable std::vector<std::pair<int, Listener>> m_Listeners;
+    mutable int m_NextId = 0;
+};
+
+#endif // OBSERVABLE_HPP
@@ -9,7 +9,8 @@ public:
     PausedScreen() {
         std::vector<std::string> optionNames = {"continue", "restart", "manage_player", "game_setting", "leave_game"};
         for (int i = 0; i < static_cast<int>(optionNames.size()); ++i) {
-            m_Options.push_back(std::make_shared<Enemy>(optionNames[i],1,std::vector{ ImagePath(optionNames[i])}));
+            const auto image = Util::AssetRegistry::Intern(ImagePath(optionNames[i]));
+            m_Options.push_back(std::make_shared<Enemy>(optionNames[i],1,Util::AssetRange::Single(image)));
             m_Options[i] -> m_Transform.scale =  {1.05f, 1.05f};
             m_Options[i] -> SetZIndex(100);
         }
@@ -94,7 +94,7 @@ private:
     bool m_IfProgressBarSet = false;
     bool m_IfLeaveSubPhase = false;
 
-
+public:
     /**
      * @brief 取得對應大關卡的名稱。
      * @param MainPhase 大關卡編號。
@@ -0,0 +1,30 @@
+#ifndef PLAYFIELD_HPP
+#define PLAYFIELD_HPP
+
+#include "config.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+
+// 遊戲畫面範圍 (以畫面中心為原點)
+namespace Playfield {
+    constexpr float HALF_WIDTH = static_cast<float>(WINDOW_WIDTH) / 2.0f;
+    constexpr float HALF_HEIGHT = static_cast<float>(WINDOW_HEIGHT) / 2.0f;
+
+    // 半徑為 radius 的圓是否完全在畫面外
+    inline bool IsOutside(const glm::vec2& center, const float radius) {
+        return std::abs(center.x) - radius > HALF_WIDTH ||
+               std::abs(center.y) - radius > HALF_HEIGHT;
+    }
+
+    // 圓已完全離開畫面，且沿著 direction 移動只會離畫面越來越遠
+    inline bool IsLeaving(const glm::vec2& center, const float radius, const glm::vec2& direction) {
+        return (center.x - radius > HALF_WIDTH && direction.x >= 0.0f) ||
+               (center.x + radius < -HALF_WIDTH && direction.x <= 0.0f) ||
+               (center.y - radius > HALF_HEIGHT && direction.y >= 0.0f) ||
+               (center.y + radius < -HALF_HEIGHT && direction.y <= 0.0f);
+    }
+}
+
+#endif // PLAYFIELD_HPP
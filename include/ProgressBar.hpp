@@ -51,13 +51,26 @@ public:
         return true;
     }
 
-    void SetVisible(const bool visible) { m_IfVisible = visible; }
+    void SetVisible(const bool visible) {
+        if (m_IfVisible == visible) return;
+        m_IfVisible = visible;
+        m_Dirty = true;
+    }
     [[nodiscard]] bool GetVisibility() const{ return m_IfVisible; }
 
-    void Update() const {
+    void Update() {
         for (const auto& icon : m_Icons) {
             icon->Update();
-            icon->SetVisible(icon->GetPosition().x >= m_Icons[5]->GetPosition().x && m_IfVisible);
+        }
+
+        // 只有進度標記會移動，標記沒動且可見度沒變時其他圖示都不用更新
+        const float markerX = m_Icons[5]->GetPosition().x;
+        if (!m_Dirty && markerX == m_LastMarkerX) return;
+        m_Dirty = false;
+        m_LastMarkerX = markerX;
+
+        for (const auto& icon : m_Icons) {
+            icon->SetVisible(icon->GetPosition().x >= markerX && m_IfVisible);
         }
         m_Icons[6]->m_Transform.scale.x = 1.12f * (m_Icons[4]->m_Transform.translation.x - m_Icons[5]->m_Transform.translation.x)/650;
         m_Icons[6]->m_Transform.translation.x = (m_Icons[5]->m_Transform.translation.x + m_Icons[4]->m_Transform.translation.x)/2;
@@ -68,6 +81,8 @@ public:
 
 private:
     bool m_IfVisible = false;
+    bool m_Dirty = true;
+    float m_LastMarkerX = 0.0f;
     glm::vec2 m_BasePosition = {-325, 300}; //{200, 300}
     std::vector<std::shared_ptr<ProgressIcon>> m_Icons;
 };
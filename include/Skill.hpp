@@ -13,7 +13,7 @@ public:
         ACTIVE
     };
 
-    Skill(int skillId, const std::vector<std::string>& imageSet, int duration = 175, float Cooldown = 2.0f);
+    Skill(int skillId, Util::AssetRange imageSet, int duration = 175, float Cooldown = 2.0f);
 
 
     std::shared_ptr<Util::Animation> GetAnimation() const { return m_Animation; }
@@ -21,7 +21,7 @@ public:
 
     // 檢查動畫是否已結束
     bool IsEnded() const;
-    const std::vector<std::string>& GetImagePathSet() const { return m_ImagePathSet; }
+    Util::AssetRange GetImageSet() const { return m_ImageSet; }
 
     // 技能
     void Update(float deltaTime);
@@ -32,7 +32,7 @@ public:
     void ResetCooldown() { m_IsOnCooldown = false; m_CurrentCooldown = 0.0f; }
 
 private:
-    std::vector<std::string> m_ImagePathSet;
+    Util::AssetRange m_ImageSet;
     std::shared_ptr<Util::Animation> m_Animation;
     State m_State = State::IDLE;
     int m_Duration = 175;
@@ -6,6 +6,7 @@
 #include "Character.hpp"
 #include "Object.hpp"
 #include "TextObject.hpp"
+#include "Observable.hpp"
 #include <memory>
 #include <string>
 #include <vector>
@@ -57,6 +58,13 @@ private:
 
     std::vector<std::shared_ptr<TextObject>> m_ExclamationMark; // 技能冷卻文字
 
+    // 角色屬性改變時設定，Update() 只處理被標記的部分
+    bool m_VisibilityDirty = true;
+    bool m_PositionDirty = true;
+    bool m_CooldownDirty = true;
+    bool m_SkillXDirty = true;
+    std::vector<Connection> m_Connections; // 放在最後，比 m_Character 先解構
+
     static std::string IconImagePath(const int skillId) {
         switch (skillId) {
             case 1: return GA_RESOURCE_DIR "/Image/UI/skill_z_icon.png";
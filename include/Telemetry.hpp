@@ -0,0 +1,49 @@
+#ifndef TELEMETRY_HPP
+#define TELEMETRY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+// 單次遊玩的效能統計，結束時寫成一份精簡的 JSON 報告
+// 每個 (大關, 小關) 各自統計，比較多份報告即可找出哪一關最吃效能
+class Telemetry {
+public:
+    Telemetry();
+
+    // 每幀呼叫一次，frameMs 為實際經過的時間 (不受遊戲時鐘快轉影響)
+    void RecordFrame(double frameMs, int mainPhase, int subPhase, size_t activeAttacks, size_t activeEffects);
+
+    // 將報告寫入 directory/session_<開始時間>.json，回傳檔案路徑，失敗時回傳空字串
+    [[nodiscard]] std::string WriteReport(const std::string& directory) const;
+
+private:
+    // 0.1 毫秒一格，超過 100 毫秒的幀都算在最後一格
+    static constexpr double BIN_MS = 0.1;
+    static constexpr size_t BIN_COUNT = 1000;
+
+    struct FrameStats {
+        uint64_t frames = 0;
+        double totalMs = 0.0;
+        double maxMs = 0.0;
+        size_t peakAttacks = 0;
+        size_t peakEffects = 0;
+        std::array<uint32_t, BIN_COUNT> histogram{};
+
+        void Add(double frameMs, size_t attacks, size_t effects);
+        [[nodiscard]] double Percentile(double fraction) const;  // 所在格子的上緣，誤差最多 BIN_MS
+    };
+
+    static std::string FrameStatsJson(const FrameStats& stats);
+    static uint64_t GetPeakRssBytes();  // 取不到時為 0
+
+    int64_t m_StartTime;  // 開始時間 (Unix 秒)，也用於檔名
+    bool m_SkippedFirst = false;  // 第一幀包含載入時間，不列入統計
+    FrameStats m_Session;
+    std::map<std::pair<int, int>, FrameStats> m_Phases;  // 以 (大關, 小關) 分類
+};
+
+#endif // TELEMETRY_HPP
@@ -3,4 +3,10 @@
 
 void App::End() { // NOLINT(this method will mutate members in the future)
     LOG_TRACE("End");
+
+    // 每次遊玩各寫一份，檔名帶開始時間，方便跨次比較
+    const std::string report = m_Telemetry.WriteReport("telemetry");
+    if (!report.empty()) {
+        LOG_INFO("Session telemetry written to {}", report);
+    }
 }
@@ -1,5 +1,8 @@
 #include "App.hpp"
 
+#include "AssetManifest.hpp"
+
+#include "Util/Image.hpp"
 #include "Util/Logger.hpp"
 #include "Effect/EffectManager.hpp"
 #include "Attack/EnemyAttackController.hpp"
@@ -8,51 +11,30 @@
 void App::Start() {
     LOG_TRACE("Start");
 
+    // 登記資源清單，之後的圖片集都以 ID 範圍傳遞
+    Asset::Load();
+
     // 初始化特效管理器（預先創建10個每種類型的特效）
     Effect::EffectManager::GetInstance().Initialize(10);
-    auto zEffect = Effect::EffectManager::GetInstance().GetEffect(Effect::EffectType::SKILL_Z);
-    zEffect->Play({-9999, -9999}, -100);
 
     // 將特效管理器添加到渲染樹
     m_Root.AddChild(std::shared_ptr<Util::GameObject>(&Effect::EffectManager::GetInstance(), [](Util::GameObject*){}));
 
-    std::vector<std::string> rabbitImages;
-    rabbitImages.reserve(2);
-    for (int i = 0; i < 2; ++i) {
-        rabbitImages.emplace_back(GA_RESOURCE_DIR"/Image/Character/hb_rabbit_idle" + std::to_string(i+1) + ".png");
-    }
-    m_Rabbit = std::make_shared<Character>(rabbitImages);
+    m_Rabbit = std::make_shared<Character>(Asset::Get(Asset::ImageSet::RABBIT_IDLE));
     glm::vec2 scale = {0.5f, 0.5f};
     m_Rabbit -> m_Transform.scale = scale;
 
-    std::vector<std::string> rabbitHurtImages;
-    rabbitHurtImages.emplace_back(GA_RESOURCE_DIR"/Image/Character/hb_rabbit_gethit.png");
-    m_Rabbit -> AddHurtAnimation(rabbitHurtImages, 500);
+    m_Rabbit -> AddHurtAnimation(Asset::Get(Asset::ImageSet::RABBIT_HURT), 500);
 
     // 技能 Z 動畫
-    std::vector<std::string> rabbitSkill1Images;
-    rabbitSkill1Images.reserve(6);
-    for (int i = 0; i < 6; ++i) {
-        rabbitSkill1Images.emplace_back(GA_RESOURCE_DIR"/Image/Character/hb_rabbit_skill1_" + std::to_string(i+1) + ".png");
-    }
-    m_Rabbit->AddSkill(1, rabbitSkill1Images, 175);  // Z鍵技能，ID=1
-    m_Rabbit->AddSkill(3, rabbitSkill1Images, 175, 7.0f);   // C鍵技能，ID=3
+    m_Rabbit->AddSkill(1, Asset::Get(Asset::ImageSet::RABBIT_SKILL_Z), 175);  // Z鍵技能，ID=1
+    m_Rabbit->AddSkill(3, Asset::Get(Asset::ImageSet::RABBIT_SKILL_Z), 175, 7.0f);   // C鍵技能，ID=3
 
     // 技能 X 動畫
-    std::vector<std::string> rabbitSkill2Images;
-    rabbitSkill2Images.reserve(5);
-    for (int i = 0; i < 5; ++i) {
-        rabbitSkill2Images.emplace_back(GA_RESOURCE_DIR"/Image/Character/hb_rabbit_skill2_" + std::to_string(i+1) + ".png");
-    }
-    m_Rabbit->AddSkill(2, rabbitSkill2Images, 175);  // X鍵技能，ID=2
+    m_Rabbit->AddSkill(2, Asset::Get(Asset::ImageSet::RABBIT_SKILL_X), 175);  // X鍵技能，ID=2
 
     // 技能 V 動畫
-    std::vector<std::string> rabbitSkill4Images;
-    rabbitSkill4Images.reserve(4);
-    for (int i = 0; i < 4; ++i) {
-        rabbitSkill4Images.emplace_back(GA_RESOURCE_DIR"/Image/Character/hb_rabbit_skill3_" + std::to_string(i+1) + ".png");
-    }
-    m_Rabbit->AddSkill(4, rabbitSkill4Images, 175, 12.0f);  // V鍵技能，ID=4
+    m_Rabbit->AddSkill(4, Asset::Get(Asset::ImageSet::RABBIT_SKILL_V), 175, 12.0f);  // V鍵技能，ID=4
 
     m_Rabbit->SetPosition({-600.5f, -140.5f});
     m_Rabbit->SetZIndex(50);
@@ -60,7 +42,7 @@ void App::Start() {
     m_Root.AddChild(m_Rabbit);
 
     // 初始化敵人，設定圖片、位置與初始可見狀態
-    m_Enemy = std::make_shared<Enemy>("dummy",100,std::vector<std::string>{GA_RESOURCE_DIR"/Image/Enemy/training_dummy_anim.png"});
+    m_Enemy = std::make_shared<Enemy>("dummy",100,Asset::Get(Asset::ImageSet::TRAINING_DUMMY));
     m_Enemy->SetShowHealthRing(true);
     m_Enemy->InitHealthRing();
     m_Root.AddChild(m_Enemy);
@@ -77,111 +59,40 @@ void App::Start() {
     m_Overlay->SetVisible(false);
     m_Root.AddChild(m_Overlay);
 
-    m_Enemy_dummy = std::make_shared<Enemy>("dummy",100,std::vector<std::string>{GA_RESOURCE_DIR"/Image/Enemy/training_dummy_anim.png"});
+    m_HealthBarOverlay = std::make_unique<HealthBarOverlay>();
+
+    m_Enemy_dummy = std::make_shared<Enemy>("dummy",100,Asset::Get(Asset::ImageSet::TRAINING_DUMMY));
     m_Enemy_dummy->SetShowHealthRing(true);
     m_Enemy_dummy->InitHealthRing();
     m_Root.AddChild(m_Enemy_dummy);
 
-    // 初始化敵人(birdStudent)，設定圖片、位置與初始閒置狀態
-    std::vector<std::string> birdStudent;
-    birdStudent.reserve(7);
-    for (int i = 7; i < 14; ++i) {
-        birdStudent.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/bird_student/bird_student_split_" + std::to_string(i+1) + ".png");
-    }
-
-    // 初始化敵人(birdWhispering)，設定圖片、位置與初始閒置狀態
-    std::vector<std::string> birdWhispering;
-    birdWhispering.reserve(7);
-    for (int i = 7; i < 14; ++i) {
-        birdWhispering.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/bird_whispering/bird_whispering_split_" + std::to_string(i+1) + ".png");
-    }
-
-    // 初始化敵人(BirdValedictorian)，設定圖片、位置與初始閒置狀態
-    std::vector<std::string> birdValedictorian;
-    birdValedictorian.reserve(8);
-    for (int i = 7; i >= 0; --i) {
-        birdValedictorian.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/bird_valedictorian/bird_valedictorian_split_" + std::to_string(i+1) + ".png");
-    }
-
-    // 初始化敵人(dragonGold)，設定圖片、位置與初始閒置狀態
-    std::vector<std::string> dragonGold;
-    dragonGold.reserve(7);
-    for (int i = 7; i < 14; ++i) {
-        dragonGold.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/dragon_gold/dragon_gold_split_" + std::to_string(i+1) + ".png");
-    }
-
-    // 初始化敵人(dragonMythril)，設定圖片、位置與初始閒置狀態
-    std::vector<std::string> dragonMythril;
-    dragonMythril.reserve(7);
-    for (int i = 7; i < 14; ++i) {
-        dragonMythril.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/dragon_mythril/dragon_mythril_split_" + std::to_string(i+1) + ".png");
-    }
-
-    // 初始化敵人(DragonSilver)，設定圖片、位置與初始閒置狀態
-    std::vector<std::string> dragonSilver;
-    dragonSilver.reserve(9);
-    dragonSilver.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/dragon_silver/dragon_silver_split_1.png");
-    dragonSilver.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/dragon_silver/dragon_silver_split_2.png");
-    for (int i = 7; i < 14; ++i) {
-        dragonSilver.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/dragon_silver/dragon_silver_split_" + std::to_string(i+1) + ".png");
-    }
-
-
-
-    // 初始化敵人(mousePaladin)，設定圖片、位置與初始閒置狀態
-    std::vector<std::string> mousePaladin;
-    mousePaladin.reserve(7);
-    for (int i = 7; i < 14; ++i) {
-        mousePaladin.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/mouse_paladin/mouse_paladin_split_" + std::to_string(i+1) + ".png");
-    }
-
-    // 初始化敵人(mouseRoseMage)，設定圖片、位置與初始閒置狀態
-    std::vector<std::string> mouseRoseMage;
-    // mouseRoseMage.reserve(7);
-    for (int i = 7; i < 14; ++i) {
-        mouseRoseMage.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/mouse_rosemage/mouse_rosemage_split_" + std::to_string(i+1) + ".png");
-    }
-
-    // 初始化敵人(mouseCommander)，設定圖片、位置與初始閒置狀態
-    std::vector<std::string> mouseCommander;
-    mouseCommander.reserve(10);
-    for (int i = 7; i < 17; ++i) {
-        mouseCommander.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/mouse_commander/mouse_commander_split_" + std::to_string(i+1) + ".png");
-    }
-
-
-    // 添加更多图片集
-    m_Enemy->SetImageSetCollection(0, std::vector<std::string>{GA_RESOURCE_DIR"/Image/Enemy/training_dummy_anim.png"});
-
-    m_Enemy->SetImageSetCollection(101, mousePaladin);
-    m_Enemy->SetImageSetCollection(102, mouseRoseMage);
-    m_Enemy->SetImageSetCollection(104, mouseCommander);
-
-    m_Enemy->SetImageSetCollection(201, dragonGold);
-    m_Enemy->SetImageSetCollection(202, dragonMythril);
-    m_Enemy->SetImageSetCollection(204, dragonSilver);
-
-    m_Enemy->SetImageSetCollection(301, birdStudent);
-    m_Enemy->SetImageSetCollection(302, birdWhispering);
-    m_Enemy->SetImageSetCollection(304, birdValedictorian);
+    // 各關卡的敵人圖片集，索引為 關卡*100+子關卡
+    m_Enemy->SetImageSetCollection(0, Asset::Get(Asset::ImageSet::TRAINING_DUMMY));
+
+    m_Enemy->SetImageSetCollection(101, Asset::Get(Asset::ImageSet::MOUSE_PALADIN));
+    m_Enemy->SetImageSetCollection(102, Asset::Get(Asset::ImageSet::MOUSE_ROSEMAGE));
+    m_Enemy->SetImageSetCollection(104, Asset::Get(Asset::ImageSet::MOUSE_COMMANDER));
+
+    m_Enemy->SetImageSetCollection(201, Asset::Get(Asset::ImageSet::DRAGON_GOLD));
+    m_Enemy->SetImageSetCollection(202, Asset::Get(Asset::ImageSet::DRAGON_MYTHRIL));
+    m_Enemy->SetImageSetCollection(204, Asset::Get(Asset::ImageSet::DRAGON_SILVER));
+
+    m_Enemy->SetImageSetCollection(301, Asset::Get(Asset::ImageSet::BIRD_STUDENT));
+    m_Enemy->SetImageSetCollection(302, Asset::Get(Asset::ImageSet::BIRD_WHISPERING));
+    m_Enemy->SetImageSetCollection(304, Asset::Get(Asset::ImageSet::BIRD_VALEDICTORIAN));
 
     m_Enemy->m_Transform.scale.x = -0.5;
 
 
 
     // 初始化敵人(Shopkeeper)，設定圖片、位置與初始閒置狀態
-    std::vector<std::string> ShopkeeperImages2;
-    ShopkeeperImages2.reserve(2);
-    for (int i = 0; i < 2; ++i) {
-        ShopkeeperImages2.emplace_back(GA_RESOURCE_DIR"/Image/Enemy/shopkeeper/cat_shopkeeper_split_" + std::to_string(i+1) + ".png");
-    }
-    m_Enemy_shopkeeper = std::make_shared<Enemy>("shopkeeper",120, ShopkeeperImages2);
+    m_Enemy_shopkeeper = std::make_shared<Enemy>("shopkeeper",120, Asset::Get(Asset::ImageSet::SHOPKEEPER));
     m_Enemy_shopkeeper->SetPosition({200.0f, -20.0f});
     m_Enemy_shopkeeper->SetInversion();
     m_Root.AddChild(m_Enemy_shopkeeper);
 
     // 初始化寶箱(Treasure)，設定圖片、位置與初始可見狀態
-    m_Enemy_treasure = std::make_shared<Enemy>("treasure",30,std::vector<std::string>{GA_RESOURCE_DIR"/Image/Enemy/treasure.png"});
+    m_Enemy_treasure = std::make_shared<Enemy>("treasure",30,Asset::Get(Asset::ImageSet::TREASURE));
     m_Enemy_treasure->SetPosition({200.0f, -20.0f});
     m_Enemy_treasure->SetInversion();
     m_Root.AddChild(m_Enemy_treasure);
@@ -197,16 +108,16 @@ void App::Start() {
     m_Root.AddChildren(m_DefeatScreen->GetChildren());
     m_DefeatScreen->SetVisible(false);
 
-    m_Onward = std::make_shared<Enemy>("Onward",1,std::vector<std::string>{GA_RESOURCE_DIR"/Image/Background/onward.png"});
+    m_Onward = std::make_shared<Enemy>("Onward",1,Asset::Get(Asset::ImageSet::ONWARD));
     m_Onward->SetPosition({500.0f, 160.0f});
     m_Root.AddChild(m_Onward);
 
-    m_GetReady = std::make_shared<Enemy>("GetReady",1,std::vector<std::string>{GA_RESOURCE_DIR"/Image/Background/get_ready.png"});
+    m_GetReady = std::make_shared<Enemy>("GetReady",1,Asset::Get(Asset::ImageSet::GET_READY));
     m_GetReady->SetPosition({0.0f, 320.0f});
     m_GetReady->SetVisible(true);
     m_Root.AddChild(m_GetReady);
 
-    m_PressZtoJoin = std::make_shared<Enemy>("GetReady",1,std::vector<std::string>{GA_RESOURCE_DIR"/Image/Background/press_Z_to_join.png"});
+    m_PressZtoJoin = std::make_shared<Enemy>("GetReady",1,Asset::Get(Asset::ImageSet::PRESS_Z_TO_JOIN));
     m_PressZtoJoin->SetPosition({0.0f, 260.0f});
     m_PressZtoJoin -> m_Transform.scale =  {0.21f, 0.21f};
     m_PressZtoJoin->SetVisible(true);
@@ -227,4 +138,11 @@ void App::Start() {
     m_CurrentState = State::UPDATE;
 
     LOG_INFO("Application started successfully");
+    // 同一路徑的圖片共用貼圖，uploads 與 hits 的比例即為省下的重複上傳
+    const auto& textures = Util::Image::GetTextureStats();
+    LOG_INFO("Textures: {} alive ({:.1f} MiB), {} uploads in {:.1f} ms, {} reused",
+             textures.textures, textures.bytes / (1024.0 * 1024.0),
+             textures.uploads, textures.uploadMs, textures.hits);
+    LOG_INFO("Downscaled textures: {} cooked, {} loaded from cache, {:.1f} MiB saved",
+             textures.cooks, textures.cookedLoads, textures.savedBytes / (1024.0 * 1024.0));
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include "App.hpp"
 
+#include "Core/Context.hpp"
+#include "Core/OverdrawView.hpp"
+
+#include "Util/AllocTracker.hpp"
 #include "Util/Input.hpp"
 #include "Util/Keycode.hpp"
 #include "Util/logger.hpp"
@@ -12,8 +16,22 @@
 #include "Attack/RectangleAttack.hpp"
 
 void App::Update() {
-    // 獲取時間增量
-    const float deltaTime = Util::Time::GetDeltaTimeMs() / 1000.0f;
+    // 其中更深的範圍 (攻擊生成、繪製、文字) 各自另外統計
+    PTSD_ALLOC_SCOPE("App::Update");
+    // 效能統計用實際時間，暫停與快轉都不影響幀時間
+    m_Telemetry.RecordFrame(Util::Time::Real().GetDeltaMs(),
+                            m_PRM->GetCurrentMainPhase(), m_PRM->GetCurrentSubPhase(),
+                            AttackManager::GetInstance().GetActiveAttacksCount(),
+                            Effect::EffectManager::GetInstance().GetActiveEffectsCount());
+
+    if (Util::Input::IsKeyUp(Util::Keycode::F3)) {
+        m_ShowDebugOverlay = !m_ShowDebugOverlay;
+    }
+
+    // 暫停畫面開啟時遊戲時鐘停止，UI 時鐘照常前進
+    Util::Time::Game().SetPaused(m_PausedOption->GetVisibility());
+    // 獲取時間增量 (遊戲時鐘，會受快轉倍率影響)
+    const float deltaTime = Util::Time::Game().GetDeltaSeconds();
 
     if (!m_IsReady) {
         GetReady();
@@ -38,7 +56,7 @@ void App::Update() {
 
 
     // 角色移動
-    constexpr float moveSpeed = 5.0f; // 調整移動速度
+    const float moveSpeed = 300.0f * deltaTime; // 每秒 300 像素，60 FPS 時與原本每幀 5 像素相同
     auto rabbitPos = m_Rabbit->GetPosition(); // 取得當前位置
     // 定義邊界
     constexpr float minX = -600.0f;
@@ -80,97 +98,89 @@ void App::Update() {
 
     const int rabbitLevel = m_Rabbit->GetLevel();
     // 技能Z
-    if (m_ZKeyDown) {
-        if (!Util::Input::IsKeyPressed(Util::Keycode::Z)) {
-            // LOG_DEBUG("Z Key UP - Skill 1");
-            if (m_Rabbit->UseSkill(1, m_enemies_characters)) {
-                for (const auto& enemy : m_Enemies) {// 遍歷範圍內的敵人
-                    if (m_Rabbit->IfCollideCircle(enemy, 200)) {
-                        float damage = 6.0f * rabbitLevel;
-                        if (m_Rabbit->IsSkillXUes()) {
-                            damage *= 1.5f;
-                        }
-                        if (m_CheatMode) {
-                            damage = 100000.0f;
-                        }
-                        enemy->TakeDamage(damage);
+    if (Util::Input::IsKeyUp(Util::Keycode::Z)) {
+        // LOG_DEBUG("Z Key UP - Skill 1");
+        if (m_Rabbit->UseSkill(1, m_enemies_characters)) {
+            RecordInputLatency(Util::Keycode::Z);
+            for (const auto& enemy : m_Enemies) {// 遍歷範圍內的敵人
+                if (m_Rabbit->IfCollideCircle(enemy, 200)) {
+                    float damage = 6.0f * rabbitLevel;
+                    if (m_Rabbit->IsSkillXUes()) {
+                        damage *= 1.5f;
+                    }
+                    if (m_CheatMode) {
+                        damage = 100000.0f;
                     }
+                    enemy->TakeDamage(damage);
                 }
-                m_Rabbit->UpdateSkillXUes(1);
             }
+            m_Rabbit->UpdateSkillXUes(1);
         }
     }
-    m_ZKeyDown = Util::Input::IsKeyPressed(Util::Keycode::Z);
 
     // 技能X
-    if (m_XKeyDown) {
-        if (!Util::Input::IsKeyPressed(Util::Keycode::X)) {
-            // LOG_DEBUG("X Key UP - Skill 2");
-            if (m_Rabbit->UseSkill(2, m_enemies_characters)) {
-                for (const auto& enemy : m_Enemies) {// 遍歷範圍內的敵人
-                    if (m_Rabbit->IfCollideSweptCircle(enemy)) {
-                        float damage = 2*rabbitLevel;
-                        if (m_CheatMode) {
-                            damage = 100000.0f;
-                        }
-                        enemy->TakeDamage(damage);
+    if (Util::Input::IsKeyUp(Util::Keycode::X)) {
+        // LOG_DEBUG("X Key UP - Skill 2");
+        if (m_Rabbit->UseSkill(2, m_enemies_characters)) {
+            RecordInputLatency(Util::Keycode::X);
+            for (const auto& enemy : m_Enemies) {// 遍歷範圍內的敵人
+                if (m_Rabbit->IfCollideSweptCircle(enemy)) {
+                    float damage = 2*rabbitLevel;
+                    if (m_CheatMode) {
+                        damage = 100000.0f;
                     }
+                    enemy->TakeDamage(damage);
                 }
-                m_Rabbit->UpdateSkillXUes(2);
             }
+            m_Rabbit->UpdateSkillXUes(2);
         }
     }
-    m_XKeyDown = Util::Input::IsKeyPressed(Util::Keycode::X);
 
     // 技能C
-    if (m_CKeyDown) {
-        if (!Util::Input::IsKeyPressed(Util::Keycode::C)) {
-            // LOG_DEBUG("C Key UP - Skill 3");
-            if (m_Rabbit->UseSkill(3, m_enemies_characters)) {
-                for (const auto& enemy : m_Enemies) {// 遍歷範圍內的敵人
-                    if (m_Rabbit->IfCollideEllipse(enemy) || true) {
-                        float damage = 10.0f * rabbitLevel;
-                        if (m_Rabbit->IsSkillXUes()) {
-                            damage *= 1.5f;
-                        }
-                        if (m_CheatMode) {
-                            damage = 100000.0f;
-                        }
-                        enemy->TakeDamage(damage);
+    if (Util::Input::IsKeyUp(Util::Keycode::C)) {
+        // LOG_DEBUG("C Key UP - Skill 3");
+        if (m_Rabbit->UseSkill(3, m_enemies_characters)) {
+            RecordInputLatency(Util::Keycode::C);
+            for (const auto& enemy : m_Enemies) {// 遍歷範圍內的敵人
+                if (m_Rabbit->IfCollideEllipse(enemy) || true) {
+                    float damage = 10.0f * rabbitLevel;
+                    if (m_Rabbit->IsSkillXUes()) {
+                        damage *= 1.5f;
+                    }
+                    if (m_CheatMode) {
+                        damage = 100000.0f;
                     }
+                    enemy->TakeDamage(damage);
                 }
-                m_Rabbit->UpdateSkillXUes(3);
             }
+            m_Rabbit->UpdateSkillXUes(3);
         }
     }
-    m_CKeyDown = Util::Input::IsKeyPressed(Util::Keycode::C);
 
     // 技能V
-    if (m_VKeyDown) {
-        if (!Util::Input::IsKeyPressed(Util::Keycode::V)) {
-            // LOG_DEBUG("V Key UP - Skill 4");
-            if (m_Rabbit->UseSkill(4, m_enemies_characters)) {
-                m_Rabbit -> TowardNearestEnemy(m_enemies_characters, false);
-                
-                // 如果技能V有傷害，添加作弊模式檢查
-                for (const auto& enemy : m_Enemies) {
-                    if (m_Rabbit->IfCollideCircle(enemy, 150)) {
-                        float damage = 8.0f * rabbitLevel;
-                        if (m_Rabbit->IsSkillXUes()) {
-                            damage *= 1.5f;
-                        }
-                        if (m_CheatMode) {
-                            damage = 100000.0f;
-                        }
-                        enemy->TakeDamage(damage);
+    if (Util::Input::IsKeyUp(Util::Keycode::V)) {
+        // LOG_DEBUG("V Key UP - Skill 4");
+        if (m_Rabbit->UseSkill(4, m_enemies_characters)) {
+            RecordInputLatency(Util::Keycode::V);
+            m_Rabbit -> TowardNearestEnemy(m_enemies_characters, false);
+            
+            // 如果技能V有傷害，添加作弊模式檢查
+            for (const auto& enemy : m_Enemies) {
+                if (m_Rabbit->IfCollideCircle(enemy, 150)) {
+                    float damage = 8.0f * rabbitLevel;
+                    if (m_Rabbit->IsSkillXUes()) {
+                        damage *= 1.5f;
                     }
+                    if (m_CheatMode) {
+                        damage = 100000.0f;
+                    }
+                    enemy->TakeDamage(damage);
                 }
-                
-                m_Rabbit->UpdateSkillXUes(4);
             }
+            
+            m_Rabbit->UpdateSkillXUes(4);
         }
     }
-    m_VKeyDown = Util::Input::IsKeyPressed(Util::Keycode::V);
 
     // 更新攻擊控制器 (如果處於活動狀態)
     if (m_EnemyAttackController && m_Enemy->GetVisibility()) {
@@ -186,18 +196,23 @@ void App::Update() {
     // 更新兔子角色
     m_Rabbit->Update();
 
-    // 更新敵人血條，是否允許(前進)
+    // 登記敵人血條並計算仍在場上的敵人，全滅才允許(前進)
+    int liveEnemies = 0;
+    int ringDraws = 0;  // 每個顯示中的血條環各一次 draw call
     for (const auto& enemy : m_Enemies) {// 遍歷範圍內的敵人
-        enemy->DrawHealthBar();
+        if (enemy->SubmitHealthBar(*m_HealthBarOverlay)) {
+            ++liveEnemies;
+            if (enemy->GetShowHealthRing()) ++ringDraws;
+        }
     }
-    if (Enemy::s_HealthBarYPositions.empty()) {
+    if (liveEnemies == 0) {
         if (!m_Onward->GetVisibility()) {
             if (m_PRM->GetCurrentSubPhase()==1 || m_PRM->GetCurrentSubPhase()==2 || m_PRM->GetCurrentSubPhase()==4) {
                 m_Rabbit->AddExperience(130);
-                LOG_INFO("AddExperience(130)");
+                LOG_DEBUG("AddExperience(130)");
             }else if (m_PRM->GetCurrentSubPhase()==3) {
                 m_Rabbit->AddMoney(30);
-                LOG_INFO("AddMoney(30)");
+                LOG_DEBUG("AddMoney(30)");
             }
         }
         if (m_PRM->GetCurrentSubPhase()==4 && m_PRM->GetCurrentMainPhase()==3) {
@@ -206,57 +221,99 @@ void App::Update() {
         m_Onward->SetVisible(true);
     } else {
         m_Onward->SetVisible(false);
-        Enemy::s_HealthBarYPositions.clear();
     }
 
     ValidTask();
 
-    // 更新敵人角色
+    // 更新敵人角色，整段每幀量一次 (不含階段管理器)，不在每隻敵人內計時
+    Uint64 enemyStart = SDL_GetPerformanceCounter();
     m_Enemy->Update();
+    Uint64 enemyCounts = SDL_GetPerformanceCounter() - enemyStart;
     m_PRM->Update();
 
+    enemyStart = SDL_GetPerformanceCounter();
     m_Enemy_dummy->Update();
+    enemyCounts += SDL_GetPerformanceCounter() - enemyStart;
+    RecordEnemyUpdate(enemyCounts, liveEnemies, ringDraws);
+
+    // 更新 HUD，並量測每幀花費的 CPU 時間 (不含階段管理器)
+    const Uint64 hudStart = SDL_GetPerformanceCounter();
     m_SkillUI->Update();
     m_HealthBarUI->Update();
     m_LevelUI->Update();
     m_DefeatScreen->Update();
+    RecordHudTime(SDL_GetPerformanceCounter() - hudStart);
 
 
     // 測試
-    if (m_NKeyDown) {
-        if (!Util::Input::IsKeyPressed(Util::Keycode::N) && m_Rabbit->GetPosition()!=glm::vec2(-100,0)) {
-            m_PausedOption->SetVisible(true);
-            LOG_DEBUG("--App::Pause--");
-        }
+    if (Util::Input::IsKeyUp(Util::Keycode::N) && m_Rabbit->GetPosition()!=glm::vec2(-100,0)) {
+        m_PausedOption->SetVisible(true);
+        LOG_DEBUG("--App::Pause--");
     }
-    m_NKeyDown = Util::Input::IsKeyPressed(Util::Keycode::N);
-
-    if (m_GKeyDown) {
-        if (!Util::Input::IsKeyPressed(Util::Keycode::G)) {
-            if (m_Rabbit) {
-                m_Rabbit->ToggleGodMode();
-                // 更新 UI 顯示
-                if (m_Rabbit->IsInGodMode()) {
-                    LOG_DEBUG("God Mode enabled - Press G to disable");
-                } else {
-                    LOG_DEBUG("God Mode disabled");
-                }
+
+    if (Util::Input::IsKeyUp(Util::Keycode::G)) {
+        if (m_Rabbit) {
+            m_Rabbit->ToggleGodMode();
+            // 更新 UI 顯示
+            if (m_Rabbit->IsInGodMode()) {
+                LOG_DEBUG("God Mode enabled - Press G to disable");
+            } else {
+                LOG_DEBUG("God Mode disabled");
             }
         }
     }
-    m_GKeyDown = Util::Input::IsKeyPressed(Util::Keycode::G);
 
-    if (m_HKeyDown) {
-        if (!Util::Input::IsKeyPressed(Util::Keycode::H)) {
-            m_CheatMode = !m_CheatMode;
-            if (m_CheatMode) {
-                LOG_DEBUG("Cheat Mode enabled - All skills damage boosted to 1000");
-            } else {
-                LOG_DEBUG("Cheat Mode disabled - Normal damage restored");
-            }
+    if (Util::Input::IsKeyUp(Util::Keycode::H)) {
+        m_CheatMode = !m_CheatMode;
+        if (m_CheatMode) {
+            LOG_DEBUG("Cheat Mode enabled - All skills damage boosted to 1000");
+        } else {
+            LOG_DEBUG("Cheat Mode disabled - Normal damage restored");
+        }
+    }
+
+#ifndef NDEBUG
+    // overdraw 熱度圖只供除錯，release 版不開放按鍵
+    if (Util::Input::IsKeyUp(Util::Keycode::O)) {
+        Core::OverdrawView::SetEnabled(!Core::OverdrawView::IsEnabled());
+        LOG_DEBUG("Overdraw view {}", Core::OverdrawView::IsEnabled() ? "enabled" : "disabled");
+    }
+#endif
+
+#ifndef NDEBUG
+    // 切換特效著色器的 uber / 特化版本，搭配 overdraw 與 draw 統計比較成本，release 版不開放
+    if (Util::Input::IsKeyUp(Util::Keycode::U)) {
+        using Effect::Shape::BaseShape;
+        BaseShape::SetUseUberShader(!BaseShape::IsUsingUberShader());
+        LOG_DEBUG("Effect shaders: {}", BaseShape::IsUsingUberShader() ? "uber" : "specialized");
+    }
+#endif
+
+#ifndef NDEBUG
+    // 將畫面逐格存成圖檔，編碼在背景執行緒進行，結束時會記錄掉格數與主執行緒額外耗時
+    // release 版不開放按鍵以免玩家誤觸，改用 config.hpp 的 STARTUP_CAPTURE_DIR 從啟動開始錄
+    if (Util::Input::IsKeyUp(Util::Keycode::F12)) {
+        auto context = Core::Context::GetInstance();
+        if (context->IsCapturing()) {
+            context->StopCapture();
+        } else {
+            context->StartCapture("capture");
         }
     }
-    m_HKeyDown = Util::Input::IsKeyPressed(Util::Keycode::H);
+#endif
+
+#ifndef NDEBUG
+    // 遊戲時鐘快轉 1x -> 4x -> 10x，供長時間測試與數值調整使用，UI 維持實際時間
+    // release 版不開放按鍵以免玩家誤觸，改用 config.hpp 的 GAME_CLOCK_SCALE
+    if (Util::Input::IsKeyUp(Util::Keycode::T)) {
+        auto& game = Util::Time::Game();
+        const double scale = game.GetScale() < 4.0 ? 4.0 : game.GetScale() < 10.0 ? 10.0 : 1.0;
+        game.SetScale(scale);
+        LOG_DEBUG("Game clock speed {}x", scale);
+    }
+#endif
 
     m_Root.Update();
+    m_HealthBarOverlay->Draw();
+    ReportDrawStats("Battle");
 }
\ No newline at end of file
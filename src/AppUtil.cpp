@@ -1,6 +1,14 @@
 #include "App.hpp"
 #include "Attack/AttackManager.hpp"
-
+#include "Core/GLState.hpp"
+#include "Core/GPUTimer.hpp"
+#include "Core/OverdrawView.hpp"
+#include "Core/SpriteBatch.hpp"
+#include "Effect/EffectManager.hpp"
+
+#include "Util/AllocTracker.hpp"
+#include "Util/AssetRegistry.hpp"
+#include "Util/Image.hpp"
 #include "Util/Input.hpp"
 #include "Util/Logger.hpp"
 #include "Util/Keycode.hpp"
@@ -10,19 +18,16 @@
  */
 void App::GetReady() {
     // 按下Z
-    if (m_ZKeyDown && m_Rabbit->GetVisibility()==false) {
-        if (!Util::Input::IsKeyPressed(Util::Keycode::Z)) {
-            m_PressZtoJoin->SetVisible(false);
+    if (Util::Input::IsKeyUp(Util::Keycode::Z) && m_Rabbit->GetVisibility()==false) {
+        m_PressZtoJoin->SetVisible(false);
 
-            m_Rabbit->SetVisible(true);
-            m_Rabbit->SetPosition(glm::vec2(-600,200));
-            m_Rabbit->MoveToPosition(glm::vec2(-200,0),1.3);
+        m_Rabbit->SetVisible(true);
+        m_Rabbit->SetPosition(glm::vec2(-600,200));
+        m_Rabbit->MoveToPosition(glm::vec2(-200,0),1.3);
 
-            m_Enemy_dummy->SetPosition(glm::vec2(580,0));
-            m_Onward->SetPosition(glm::vec2(980,160));
-        }
+        m_Enemy_dummy->SetPosition(glm::vec2(580,0));
+        m_Onward->SetPosition(glm::vec2(980,160));
     }
-    m_ZKeyDown = Util::Input::IsKeyPressed(Util::Keycode::Z);
 
     if (m_Rabbit->GetPosition().x == -200) {
         m_Rabbit->MoveToPosition(glm::vec2(-100,0),1.3);
@@ -44,6 +49,7 @@ void App::GetReady() {
     m_Enemy_dummy->Update();
     m_Onward->Update();
     m_Root.Update();
+    ReportDrawStats("Title");
 }
 
 /**
@@ -51,7 +57,7 @@ void App::GetReady() {
  */
 void App::Pause() {
     m_PRM->SetProgressBarVisible(true);
-    if (m_EnterDown && !Util::Input::IsKeyPressed(Util::Keycode::N)) {
+    if (Util::Input::IsKeyUp(Util::Keycode::N)) {
         switch (m_PausedOption->GetCurrentOption()) {
             case 0:
                 m_PausedOption->SetVisible(false);
@@ -73,17 +79,14 @@ void App::Pause() {
                 LOG_ERROR("--App::Pause Switch Default--");
         }
     }
-    m_EnterDown = Util::Input::IsKeyPressed(Util::Keycode::N);
 
-    if (m_UpKeyDown && !Util::Input::IsKeyPressed(Util::Keycode::UP)) {
+    if (Util::Input::IsKeyUp(Util::Keycode::UP)) {
         m_PausedOption->Switch(true);
     }
-    m_UpKeyDown = Util::Input::IsKeyPressed(Util::Keycode::UP);
 
-    if (m_DownKeyDown && !Util::Input::IsKeyPressed(Util::Keycode::DOWN)) {
+    if (Util::Input::IsKeyUp(Util::Keycode::DOWN)) {
         m_PausedOption->Switch(false);
     }
-    m_DownKeyDown = Util::Input::IsKeyPressed(Util::Keycode::DOWN);
 
     m_PRM->Update();
     m_PausedOption->Update();
@@ -94,7 +97,7 @@ void App::Pause() {
  * @brief 結算畫面。
  */
 void App::Defeat(){
-    if (m_EnterDown && !Util::Input::IsKeyPressed(Util::Keycode::N)) {
+    if (Util::Input::IsKeyUp(Util::Keycode::N)) {
         switch (m_DefeatScreen->GetCurrentOption()) {
             case 0:
                 LOG_DEBUG("--App::Defeat Leave_Game--");
@@ -109,17 +112,14 @@ void App::Defeat(){
                 LOG_ERROR("--App::Defeat Switch Default--");
         }
     }
-    m_EnterDown = Util::Input::IsKeyPressed(Util::Keycode::N);
 
-    if (m_LeftKeyDown && !Util::Input::IsKeyPressed(Util::Keycode::LEFT)) {
+    if (Util::Input::IsKeyUp(Util::Keycode::LEFT)) {
         m_DefeatScreen->Switch(true);
     }
-    m_LeftKeyDown = Util::Input::IsKeyPressed(Util::Keycode::LEFT);
 
-    if (m_RightKeyDown && !Util::Input::IsKeyPressed(Util::Keycode::RIGHT)) {
+    if (Util::Input::IsKeyUp(Util::Keycode::RIGHT)) {
         m_DefeatScreen->Switch(false);
     }
-    m_RightKeyDown = Util::Input::IsKeyPressed(Util::Keycode::RIGHT);
 
     m_DefeatScreen->Update();
     m_Root.Update();
@@ -129,23 +129,20 @@ void App::Defeat(){
  * @brief 商店畫面。
  */
 void App::Shop() {
-    if (m_EnterDown && !Util::Input::IsKeyPressed(Util::Keycode::E)) {
+    if (Util::Input::IsKeyUp(Util::Keycode::E)) {
         m_shopUI->SetVisible(false);
         m_PRM->SetProgressBarVisible(true);
     }
-    m_EnterDown = Util::Input::IsKeyPressed(Util::Keycode::E);
 
-    if (m_LeftKeyDown && !Util::Input::IsKeyPressed(Util::Keycode::LEFT)) {
+    if (Util::Input::IsKeyUp(Util::Keycode::LEFT)) {
         m_shopUI->SwitchProduct(true);
     }
-    m_LeftKeyDown = Util::Input::IsKeyPressed(Util::Keycode::LEFT);
 
-    if (m_RightKeyDown && !Util::Input::IsKeyPressed(Util::Keycode::RIGHT)) {
+    if (Util::Input::IsKeyUp(Util::Keycode::RIGHT)) {
         m_shopUI->SwitchProduct(false);
     }
-    m_RightKeyDown = Util::Input::IsKeyPressed(Util::Keycode::RIGHT);
 
-    if (m_NKeyDown && !Util::Input::IsKeyPressed(Util::Keycode::N)) {
+    if (Util::Input::IsKeyUp(Util::Keycode::N)) {
         if (m_Rabbit->GetMoney()>=5) {
             if (m_shopUI->GetProduct()==0 && m_HealthBarUI->GetHealthBar()!=3) {
                 m_Rabbit->AddMoney(-5);
@@ -157,12 +154,12 @@ void App::Shop() {
             }
         }
     }
-    m_NKeyDown = Util::Input::IsKeyPressed(Util::Keycode::N);
 
     m_HealthBarUI->Update();
     m_LevelUI->Update();
     m_Rabbit->Update();
     m_Root.Update();
+    ReportDrawStats("Shop");
 }
 /**
  * @brief 驗證當前任務狀態，並切換至適當的階段。
@@ -179,11 +176,10 @@ void App::ValidTask() {
         m_DefeatScreen->Get(false);
     }
     if (m_Enemy_shopkeeper->GetVisibility()) {
-        if (m_RKeyDown && !Util::Input::IsKeyPressed(Util::Keycode::R)) {
+        if (Util::Input::IsKeyUp(Util::Keycode::R)) {
             m_shopUI->SetVisible(true);
             m_PRM->SetProgressBarVisible(false);
         }
-        m_RKeyDown = Util::Input::IsKeyPressed(Util::Keycode::R);
     }
 }
 
@@ -340,17 +336,84 @@ void App::RestartGame() {
     m_DefeatScreen->SetVisible(false);
     m_DefeatScreen->Reset();
 
-    // 8. 重置鍵盤狀態追蹤變量
-    m_ZKeyDown = false;
-    m_XKeyDown = false;
-    m_CKeyDown = false;
-    m_VKeyDown = false;
-    m_NKeyDown = false;
-    m_EnterDown = false;
-    m_UpKeyDown = false;
-    m_DownKeyDown = false;
-    m_LeftKeyDown = false;
-    m_RightKeyDown = false;
-
     LOG_INFO("Game restart completed. Waiting for player to press Z to join.");
-}
\ No newline at end of file
+}
+
+void App::RecordHudTime(const Uint64 counts) {
+    const double ms = 1000.0 * static_cast<double>(counts) / static_cast<double>(SDL_GetPerformanceFrequency());
+    m_HudTimeMs += ms;
+    m_HudPeakMs = std::max(m_HudPeakMs, ms);
+
+    if (++m_HudFrames < HUD_TIMING_FRAMES) return;
+    LOG_DEBUG("HUD update: avg {:.4f} ms, peak {:.4f} ms over {} frames",
+              m_HudTimeMs / m_HudFrames, m_HudPeakMs, m_HudFrames);
+    m_HudTimeMs = 0.0;
+    m_HudPeakMs = 0.0;
+    m_HudFrames = 0;
+}
+
+void App::RecordEnemyUpdate(const Uint64 counts, const int liveEnemies, const int ringDraws) {
+    if (liveEnemies == 0) return;
+    m_EnemyUpdateMs += 1000.0 * static_cast<double>(counts) / static_cast<double>(SDL_GetPerformanceFrequency());
+    m_EnemyFrames += liveEnemies;
+    m_EnemyRingDraws += ringDraws;
+}
+
+void App::RecordInputLatency(const Util::Keycode key) {
+    const double ms = Util::Input::GetEdgeAgeMs(key);
+    m_InputLatencyMs += ms;
+    m_InputLatencyPeakMs = std::max(m_InputLatencyPeakMs, ms);
+    ++m_InputLatencyCount;
+}
+
+void App::ReportDrawStats(const char* screen) {
+    if (++m_DrawStatsFrames < HUD_TIMING_FRAMES) return;
+    m_DrawStatsFrames = 0;
+
+    const auto gl = Core::GLState::GetLastFrameStats();
+    const auto sprites = Core::SpriteBatch::GetLastFrameStats();
+    LOG_DEBUG("{} screen: {} draws/frame, {} sprites ({} opaque) in {} batched draws",
+              screen, gl.draws, sprites.sprites, sprites.opaque, sprites.draws);
+    // 狀態快取的成效：實際送出與因狀態相同而省略的綁定/狀態切換，release 版也要看得到
+    LOG_INFO("{} screen: {} GL state changes issued, {} redundant ones elided per frame",
+             screen, gl.stateChanges, gl.redundantStateChanges);
+    if (m_EnemyFrames > 0) {
+        LOG_INFO("{} screen: enemy update {:.4f} ms and {:.2f} health ring draws per live enemy",
+                 screen, m_EnemyUpdateMs / m_EnemyFrames,
+                 static_cast<double>(m_EnemyRingDraws) / m_EnemyFrames);
+        m_EnemyUpdateMs = 0.0;
+        m_EnemyFrames = 0;
+        m_EnemyRingDraws = 0;
+    }
+    if (Core::OverdrawView::IsEnabled()) {
+        LOG_DEBUG("{} screen: average overdraw {:.2f}", screen, Core::OverdrawView::GetLastAverage());
+    }
+    LOG_DEBUG("{} screen: {} objects and {} effects culled, {} attacks despawned early",
+              screen, m_Root.GetCulledCount(),
+              Effect::EffectManager::GetInstance().GetCulledCount(),
+              AttackManager::GetInstance().GetEarlyDespawnCount());
+    const auto& images = Util::Image::GetStoreStats();
+    LOG_DEBUG("{} screen: {} decoded images ({:.1f} MiB), {} hits, {} misses, {} evicted",
+              screen, images.entries, images.bytes / (1024.0 * 1024.0),
+              images.hits, images.misses, images.evictions);
+    // 以 ID 查詢不經過雜湊，這個數字在遊戲進行中應幾乎不再增加
+    LOG_DEBUG("{} screen: {} asset paths interned, {} hashed path lookups so far",
+              screen, Util::AssetRegistry::GetCount(), Util::AssetRegistry::GetStats().hashedLookups);
+    if (m_InputLatencyCount > 0) {
+        LOG_DEBUG("{} screen: input to skill latency avg {:.2f} ms, peak {:.2f} ms over {} skills, {} input events dropped",
+                  screen, m_InputLatencyMs / m_InputLatencyCount, m_InputLatencyPeakMs,
+                  m_InputLatencyCount, Util::Input::GetDroppedEvents());
+        m_InputLatencyMs = 0.0;
+        m_InputLatencyPeakMs = 0.0;
+        m_InputLatencyCount = 0;
+    }
+}
+
+void App::DrawDebugOverlay() const {
+    if (!m_ShowDebugOverlay) return;
+
+    Core::GPUTimer::DrawWindow();
+#ifdef PTSD_ALLOC_TRACKING
+    Util::AllocTracker::DrawWindow();
+#endif
+}
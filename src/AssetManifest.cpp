@@ -0,0 +1,95 @@
+#include "AssetManifest.hpp"
+
+#include "Util/Logger.hpp"
+#include "Util/Time.hpp"
+
+#include <array>
+
+namespace {
+    using Asset::ImageSet;
+
+    // 一列代表一段連號圖片：file 中的 {} 代換為 first 到 last 的編號 (first > last 時倒序)，
+    // first 為 0 表示單張圖片。同一圖片集的多列必須相鄰，才能取得連號 ID
+    struct Sequence {
+        ImageSet set;
+        const char* file;
+        int first;
+        int last;
+    };
+
+    constexpr Sequence MANIFEST[] = {
+        {ImageSet::RABBIT_IDLE, "/Image/Character/hb_rabbit_idle{}.png", 1, 2},
+        {ImageSet::RABBIT_HURT, "/Image/Character/hb_rabbit_gethit.png", 0, 0},
+        {ImageSet::RABBIT_SKILL_Z, "/Image/Character/hb_rabbit_skill1_{}.png", 1, 6},
+        {ImageSet::RABBIT_SKILL_X, "/Image/Character/hb_rabbit_skill2_{}.png", 1, 5},
+        {ImageSet::RABBIT_SKILL_V, "/Image/Character/hb_rabbit_skill3_{}.png", 1, 4},
+
+        {ImageSet::TRAINING_DUMMY, "/Image/Enemy/training_dummy_anim.png", 0, 0},
+        {ImageSet::MOUSE_PALADIN, "/Image/Enemy/mouse_paladin/mouse_paladin_split_{}.png", 8, 14},
+        {ImageSet::MOUSE_ROSEMAGE, "/Image/Enemy/mouse_rosemage/mouse_rosemage_split_{}.png", 8, 14},
+        {ImageSet::MOUSE_COMMANDER, "/Image/Enemy/mouse_commander/mouse_commander_split_{}.png", 8, 17},
+        {ImageSet::DRAGON_GOLD, "/Image/Enemy/dragon_gold/dragon_gold_split_{}.png", 8, 14},
+        {ImageSet::DRAGON_MYTHRIL, "/Image/Enemy/dragon_mythril/dragon_mythril_split_{}.png", 8, 14},
+        {ImageSet::DRAGON_SILVER, "/Image/Enemy/dragon_silver/dragon_silver_split_{}.png", 1, 2},
+        {ImageSet::DRAGON_SILVER, "/Image/Enemy/dragon_silver/dragon_silver_split_{}.png", 8, 14},
+        {ImageSet::BIRD_STUDENT, "/Image/Enemy/bird_student/bird_student_split_{}.png", 8, 14},
+        {ImageSet::BIRD_WHISPERING, "/Image/Enemy/bird_whispering/bird_whispering_split_{}.png", 8, 14},
+        {ImageSet::BIRD_VALEDICTORIAN, "/Image/Enemy/bird_valedictorian/bird_valedictorian_split_{}.png", 8, 1},
+        {ImageSet::SHOPKEEPER, "/Image/Enemy/shopkeeper/cat_shopkeeper_split_{}.png", 1, 2},
+        {ImageSet::TREASURE, "/Image/Enemy/treasure.png", 0, 0},
+
+        {ImageSet::ONWARD, "/Image/Background/onward.png", 0, 0},
+        {ImageSet::GET_READY, "/Image/Background/get_ready.png", 0, 0},
+        {ImageSet::PRESS_Z_TO_JOIN, "/Image/Background/press_Z_to_join.png", 0, 0},
+    };
+
+    std::array<Util::AssetRange, static_cast<std::size_t>(ImageSet::COUNT)> s_Sets;
+
+    std::string MakePath(const char* file, const int number) {
+        std::string path = GA_RESOURCE_DIR;
+        path += file;
+        if (number != 0) {
+            path.replace(path.find("{}"), 2, std::to_string(number));
+        }
+        return path;
+    }
+}
+
+namespace Asset {
+    void Load() {
+        const auto start = Util::Time::GetElapsedTimeMs();
+        const auto before = Util::AssetRegistry::GetStats();
+
+        const Sequence* previous = nullptr;
+        for (const auto& row : MANIFEST) {
+            auto& range = s_Sets[static_cast<std::size_t>(row.set)];
+            if (previous == nullptr || previous->set != row.set) {
+                range = {};
+            }
+            previous = &row;
+
+            const int step = row.first <= row.last ? 1 : -1;
+            for (int number = row.first;; number += step) {
+                const auto id = Util::AssetRegistry::Intern(MakePath(row.file, number));
+                if (range.empty()) {
+                    range.first = id;
+                } else if (id != range.first + range.count) {
+                    // 路徑在清單之前已被登記過，無法成為連號範圍
+                    LOG_ERROR("Asset manifest: '{}' is not consecutive with its set",
+                              Util::AssetRegistry::GetPath(id));
+                }
+                range.count++;
+                if (number == row.last) break;
+            }
+        }
+
+        const auto& after = Util::AssetRegistry::GetStats();
+        LOG_INFO("Asset manifest: {} sets, {} new paths ({} bytes) interned in {:.2f} ms",
+                 s_Sets.size(), after.assets - before.assets,
+                 after.pathBytes - before.pathBytes, Util::Time::GetElapsedTimeMs() - start);
+    }
+
+    Util::AssetRange Get(const ImageSet set) {
+        return s_Sets[static_cast<std::size_t>(set)];
+    }
+}
@@ -22,6 +22,9 @@ void AttackManager::Update(float deltaTime, std::shared_ptr<Character> &player)
         }
         // 如果攻擊已完成 從活躍列表中移除
         if (attack->IsFinished()) {
+            if (attack->WasDespawnedEarly()) {
+                ++m_EarlyDespawns;
+            }
             it = m_ActiveAttacks.erase(it);
         } else {
             ++it;
@@ -1,4 +1,5 @@
 #include "Attack/AttackPatternFactory.hpp"
+#include "Util/AllocTracker.hpp"
 #include "Util/Logger.hpp"
 #include <cmath>
 #include <random>
@@ -101,6 +102,7 @@ std::vector<glm::vec2> AttackPatternFactory::CalculateCircularPositions(
 }
 
 std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle1Pattern() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
 
     glm::vec2 centerPosition(200.0f, 0.0f);
@@ -254,6 +256,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle1Pattern() {
 }
 
 std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle2Pattern() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 centerPosition(0.0f, 0.0f);
     pattern->AddEnemyMovement([centerPosition](const std::shared_ptr<Enemy>& enemy, float totalTime) {
@@ -301,6 +304,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle2Pattern() {
 }
 
 std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle3Pattern() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 centerPosition(0.0f, 0.0f);
     pattern->AddEnemyMovement([centerPosition](const std::shared_ptr<Enemy>& enemy, float totalTime) {
@@ -368,6 +372,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle3Pattern() {
 }
 
 std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle4Pattern() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 centerPosition(0.0f, 0.0f);
     pattern->AddEnemyMovement([centerPosition](const std::shared_ptr<Enemy>& enemy, float totalTime) {
@@ -454,6 +459,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle4Pattern() {
 }
 
 std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle5Pattern() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 position(0.0f, 0.0f);
     pattern->AddEnemyMovement([position](const std::shared_ptr<Enemy>& enemy, float totalTime) {
@@ -536,6 +542,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle5Pattern() {
 }
 
 std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle6Pattern() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 centerPosition(0.0f, 0.0f);
     pattern->AddEnemyMovement([centerPosition](const std::shared_ptr<Enemy>& enemy, float totalTime) {
@@ -651,6 +658,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle6Pattern() {
 }
 
 std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle7Pattern() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 centerPosition(0.0f, 0.0f);
     pattern->AddEnemyMovement([centerPosition](const std::shared_ptr<Enemy>& enemy, float totalTime) {
@@ -717,6 +725,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle7Pattern() {
 }
 
 std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle8Pattern() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 centerPosition(0.0f, 0.0f);
     pattern->AddEnemyMovement([centerPosition](const std::shared_ptr<Enemy>& enemy, float totalTime) {
@@ -783,6 +792,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::CreateBattle8Pattern() {
 }
 
 std::shared_ptr<AttackPattern> AttackPatternFactory::BossPattern1() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 centerPosition(0.0f, 0.0f);
     pattern->AddEnemyMovement([centerPosition](const std::shared_ptr<Enemy>& enemy, float totalTime) {
@@ -803,6 +813,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::BossPattern1() {
     return pattern;
 }
 std::shared_ptr<AttackPattern> AttackPatternFactory::BossPattern2() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 centerPosition(0.0f, 0.0f);
     pattern->AddEnemyMovement([centerPosition](const std::shared_ptr<Enemy>& enemy, float totalTime) {
@@ -833,6 +844,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::BossPattern2() {
     return pattern;
 }
 std::shared_ptr<AttackPattern> AttackPatternFactory::BossPattern3() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 centerPosition(0.0f, 0.0f);
     pattern->AddEnemyMovement([centerPosition](const std::shared_ptr<Enemy>& enemy, float totalTime) {
@@ -857,6 +869,7 @@ std::shared_ptr<AttackPattern> AttackPatternFactory::BossPattern3() {
     return pattern;
 }
 std::shared_ptr<AttackPattern> AttackPatternFactory::BossPattern4() {
+    PTSD_ALLOC_SCOPE("AttackPatternFactory");
     auto pattern = std::make_shared<AttackPattern>();
     glm::vec2 centerPosition(0.0f, 0.0f);
     pattern->AddEnemyMovement([centerPosition](const std::shared_ptr<Enemy>& enemy, float totalTime) {
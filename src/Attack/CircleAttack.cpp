@@ -1,6 +1,7 @@
 #include "Attack/CircleAttack.hpp"
 #include "Effect/EffectManager.hpp"
 #include "Util/Logger.hpp"
+#include "Playfield.hpp"
 #include <cmath>
 #include <App.hpp>
 
@@ -133,6 +134,17 @@ void CircleAttack::OnAttackStart() {
     }
 }
 
+void CircleAttack::OnAttackUpdate(float deltaTime) {
+    Attack::OnAttackUpdate(deltaTime);
+
+    // 移動中的攻擊一旦整個離開畫面且不會再回來，就不必等移動距離走完
+    float visualRadius = m_Radius * 1.25f;
+    if (m_IsMoving && Playfield::IsLeaving(m_Position, visualRadius, m_Direction)) {
+        m_DespawnedEarly = true;
+        ChangeState(State::FINISHED);
+    }
+}
+
 void CircleAttack::CleanupVisuals() {
     Attack::CleanupVisuals();
     if (m_DirectionIndicator) {
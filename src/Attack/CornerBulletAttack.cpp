@@ -1,4 +1,5 @@
 #include "Attack/CornerBulletAttack.hpp"
+#include "Util/AllocTracker.hpp"
 #include "Util/Logger.hpp"
 #include "Effect/EffectManager.hpp"
 #include "Attack/AttackManager.hpp"
@@ -111,6 +112,8 @@ void CornerBulletAttack::CreateWarningEffect() {
 }
 
 void CornerBulletAttack::CreateAttackEffect() {
+    // 每顆子彈各自一個 shared_ptr，是攻擊生成時配置的大宗
+    PTSD_ALLOC_SCOPE("CornerBulletAttack");
     m_BulletAttacks.clear();
 
     int bulletIndex = 0;
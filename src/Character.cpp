@@ -5,26 +5,29 @@
 #include "Util/Time.hpp"
 #include "Util/TransformUtils.hpp"
 
-Character::Character(const std::vector<std::string>& ImagePathSet) {
+#include <cmath>
+
+Character::Character(const Util::AssetRange ImageSet) {
     // 建立閒置動畫
-    m_IdleAnimation = std::make_shared<Util::Animation>(ImagePathSet, true, 250, true, 0);
+    m_IdleAnimation = std::make_shared<Util::Animation>(ImageSet, true, 250, true, 0);
     // 初始時設置為閒置動畫
     m_Drawable = m_IdleAnimation;
-    m_ImagePathSet = ImagePathSet;
+    m_ImageSet = ImageSet;
     ResetPosition();
 
     // 初始血量設置
-    m_Health = 100;
+    m_Health.Set(100);
     m_MaxHealth = 100;
 
-    LOG_INFO("Character created with {} health", m_Health);
+    LOG_INFO("Character created with {} health", m_Health.Get());
 }
 
-void Character::AddSkill(int skillId, const std::vector<std::string>& skillImageSet,
+void Character::AddSkill(int skillId, const Util::AssetRange skillImageSet,
                         int duration, float Cooldown) {
     // 創建並儲存新技能
     auto newSkill = std::make_shared<Skill>(skillId, skillImageSet, duration, Cooldown);
     m_Skills[skillId] = newSkill;
+    m_CooldownSeconds[skillId]; // 先建立冷卻屬性，讓 UI 可以訂閱
     LOG_DEBUG("Added skill with ID: " + std::to_string(skillId));
 }
 
@@ -58,19 +61,20 @@ void Character::ResetSkill() {
     m_IsSkillXUes = false;
     m_IsSkillCUes = false;
     m_IsSkillVUes = false;
-    LOG_INFO("X: " + std::to_string(m_IsSkillXUes) +
-            " C: " + std::to_string(m_IsSkillCUes) +
-            " V: " + std::to_string(m_IsSkillVUes));
+    LOG_DEBUG("X: {} C: {} V: {}", m_IsSkillXUes, m_IsSkillCUes, m_IsSkillVUes);
 
     for (auto it = m_Skills.begin(); it != m_Skills.end(); ++it) {
         it->second->ResetCooldown();
     }
+    PublishState();
 }
 
 
 void Character::Update() {
+    // 遊戲時鐘，暫停與快轉時跟著停止或加速
+    const float DeltaTimeMs = static_cast<float>(Util::Time::Game().GetDeltaMs());
     if (m_Invincible && !m_GodMode) {
-        m_InvincibleTimer += Util::Time::GetDeltaTimeMs() / 1000.0f;
+        m_InvincibleTimer += DeltaTimeMs / 1000.0f;
         if (m_InvincibleTimer >= m_InvincibleDuration) {
             m_Invincible = false;
             m_InvincibleTimer = 0.0f;
@@ -84,7 +88,7 @@ void Character::Update() {
 
     // 更新技能
     for (auto it = m_Skills.begin(); it != m_Skills.end(); ++it) {
-        it->second->Update(Util::Time::GetDeltaTimeMs() / 1000.0f);
+        it->second->Update(DeltaTimeMs / 1000.0f);
     }
     if (m_State == State::USING_SKILL && m_CurrentSkill) {
         // 檢查技能是否結束
@@ -94,7 +98,7 @@ void Character::Update() {
     }
     else if (m_State == State::HURT) {
         // 更新受傷動畫計時器
-        m_HurtAnimationTimer += Util::Time::GetDeltaTimeMs() / 1000.0f;
+        m_HurtAnimationTimer += DeltaTimeMs / 1000.0f;
 
         // 如果受傷動畫結束，切回閒置狀態
         if (m_HurtAnimationTimer >= m_HurtAnimationDuration) {
@@ -107,7 +111,6 @@ void Character::Update() {
     // 移動位置
     if (m_IsMoving) {
         // 計算移動距離
-        const float DeltaTimeMs = Util::Time::GetDeltaTimeMs();
         m_TotalTime -= DeltaTimeMs;
         // 更新位置
         m_Transform.translation += m_MoveSpeed * DeltaTimeMs / 1000.0f;
@@ -123,6 +126,25 @@ void Character::Update() {
         SwitchToSkill(3);
         m_IsSkillCUes=false;
     }
+
+    PublishState();
+}
+
+void Character::SetVisible(const bool visible) {
+    GameObject::SetVisible(visible);
+    m_VisibilityProperty.Set(visible);
+}
+
+void Character::PublishState() {
+    m_PositionProperty.Set(m_Transform.translation);
+    m_VisibilityProperty.Set(m_Visible);
+    m_SkillXProperty.Set(m_IsSkillXUes);
+
+    // 只發布顯示用的秒數，小數變化不會觸發 HUD 更新
+    for (const auto& [skillId, skill] : m_Skills) {
+        const float remaining = skill->GetRemainingCooldown();
+        m_CooldownSeconds[skillId].Set(remaining > 0.5f ? static_cast<int>(std::lround(remaining)) : 0);
+    }
 }
 
 void Character::SwitchToIdle() {
@@ -207,6 +229,7 @@ void Character::MovePosition(const glm::vec2& Position, const float totalTime) {
 void Character::MoveToPosition(const glm::vec2& targetPosition, const float totalTime) {
     if (totalTime <= 0.0f) {
         m_Transform.translation = targetPosition;
+        PublishState();
         return;
     }
 
@@ -224,8 +247,8 @@ void Character::TakeDamage(int damage) {
     }
 
     // 扣血
-    m_Health = std::max(0, m_Health - damage);
-    LOG_INFO("Character took {} damage, health: {}/{}", damage, m_Health, m_MaxHealth);
+    m_Health.Set(std::max(0, m_Health.Get() - damage));
+    LOG_INFO("Character took {} damage, health: {}/{}", damage, m_Health.Get(), m_MaxHealth);
 
     // 進入無敵
     m_Invincible = true;
@@ -234,28 +257,28 @@ void Character::TakeDamage(int damage) {
     SwitchToHurt();
 
     // 死亡
-    if (m_Health <= 0) {
+    if (m_Health.Get() <= 0) {
         LOG_INFO("Character defeated!");
     }
 }
 
 void Character::SetMaxHealth(int maxHealth) {
     m_MaxHealth = maxHealth;
-    m_Health = std::min(m_Health, m_MaxHealth); // 確保當前血量不超過最大值
-    LOG_INFO("Character max health set to {}, current health: {}", m_MaxHealth, m_Health);
+    m_Health.Set(std::min(m_Health.Get(), m_MaxHealth)); // 確保當前血量不超過最大值
+    LOG_INFO("Character max health set to {}, current health: {}", m_MaxHealth, m_Health.Get());
 }
 
-void Character::AddHurtAnimation(const std::vector<std::string>& hurtImageSet, int duration) {
+void Character::AddHurtAnimation(const Util::AssetRange hurtImageSet, int duration) {
     // 創建受傷動畫
     m_HurtAnimation = std::make_shared<Util::Animation>(hurtImageSet, true, duration, false, 0);
     m_HurtAnimationDuration = duration / 1000.0f;
 }
 
 void Character::UpdateLevel() {
-    if (m_Experience >= 100) {
-        m_Experience -= 100;
-        m_Level++;
-        LOG_INFO("Character Level Up {}  --Exp: {}", m_Level, m_Experience);
+    if (m_Experience.Get() >= 100) {
+        m_Experience.Set(m_Experience.Get() - 100);
+        m_Level.Set(m_Level.Get() + 1);
+        LOG_INFO("Character Level Up {}  --Exp: {}", m_Level.Get(), m_Experience.Get());
     }
 }
 
@@ -268,7 +291,7 @@ void Character::Reset() {
     m_CurrentSkillId = -1;
 
     // 血量相關屬性
-    m_Health = m_MaxHealth;       // 最大血量
+    m_Health.Set(m_MaxHealth);    // 最大血量
     m_Invincible = false; // 是否處於無敵狀態
     m_InvincibleTimer = 0.0f; // 無敵時間計時器
     m_InvincibleDuration = 1.5f; // 無敵時間(秒)
@@ -286,9 +309,9 @@ void Character::Reset() {
 
     m_Transform.scale.x = 0.5;
 
-    m_Money = 0;
-    m_Experience = 0;
-    m_Level = 1;
+    m_Money.Set(0);
+    m_Experience.Set(0);
+    m_Level.Set(1);
     SwitchToIdle();
     ResetSkill();
 }
@@ -41,7 +41,7 @@ DefeatScreen::DefeatScreen(const std::shared_ptr<Character>& character)
     constexpr int baseY2 = 230;
     constexpr float spacing = 126.0f;
     for (int i = 0; i < static_cast<int>(PhasesNums.size()); ++i) {
-        m_PassedPhases.push_back(std::make_shared<Object>(GA_RESOURCE_DIR "/Image/UI/stage_icon_000" + PhasesNums[i] + ".png") );
+        m_PassedPhases.push_back(std::make_shared<Object>(GA_RESOURCE_DIR "/Image/UI/stage_icon_000" + PhasesNums[i] + ".png", 0.1f) );
         m_PassedPhases[i] -> SetScale(0.1,0.1);
         m_PassedPhases[i] -> SetZIndex(90);
         m_PassedPhases[i] -> SetPosition(glm::vec2{baseX2+spacing*i, baseY2});
@@ -59,6 +59,8 @@ DefeatScreen::DefeatScreen(const std::shared_ptr<Character>& character)
     m_Children.push_back(m_GameTime);
     m_Children.push_back(m_UserName);
     m_Children.push_back(m_Level);
+
+    m_Connections.push_back(m_Character->LevelProperty().Subscribe([this](int) { m_LevelDirty = true; }));
 }
 
 
@@ -101,13 +103,18 @@ void DefeatScreen::Get(const bool isVictory = false) {
         }
     }
     m_GameTime -> SetText(StringGameTime(m_GameTimer));
-    m_Level -> SetText(std::to_string(m_Character->GetLevel()));
+    if (m_LevelDirty) {
+        m_Level -> SetText(std::to_string(m_Character->GetLevel()));
+        m_LevelDirty = false;
+    }
 }
 
 void DefeatScreen::Update(){
     if (m_IsGameStart) {
-        m_GameTimer += Util::Time::GetDeltaTimeMs();
+        m_GameTimer += Util::Time::Game().GetDeltaMs();
     }
+    // 畫面隱藏時選項不會被操作，不必每幀更新
+    if (!m_IfVisible) return;
     for (const auto& option : m_Options) {
         option->Update();
     }
@@ -1,4 +1,5 @@
 #include "Effect/CompositeEffect.hpp"
+#include "Core/GLBackend.hpp"
 #include "Util/Logger.hpp"
 
 namespace Effect {
@@ -12,37 +13,21 @@ namespace Effect {
 
     void CompositeEffect::Draw(const Core::Matrices& data) {
         if (m_State != State::ACTIVE || !m_BaseShape) return;
-        Core::Program* program = nullptr;
-
-        if (auto circleShape = dynamic_cast<Shape::CircleShape*>(m_BaseShape.get())) {
-            (void) circleShape;
-            program = Shape::CircleShape::GetProgram();
-        } else if (auto ellipseShape = dynamic_cast<Shape::EllipseShape*>(m_BaseShape.get())) {
-            (void) ellipseShape;
-            program = Shape::EllipseShape::GetProgram();
-        } else if (auto rectangleShape = dynamic_cast<Shape::RectangleShape*>(m_BaseShape.get())) {
-            (void) rectangleShape;
-            program = Shape::RectangleShape::GetProgram();
-        }
-
-        if (!program) {
-            LOG_ERROR("Failed to get program for CompositeEffect - BaseShape type not recognized");
-            return;
-        }
 
-        program->Bind();
+        // 依修飾器選擇特化的著色程式，模式分支在編譯時就被移除
+        const Shape::Variant::Mask variant = Shape::Variant::SPECIALIZED |
+                                             m_FillModifier.GetVariant() |
+                                             m_EdgeModifier.GetVariant();
+        Core::Program& program = m_BaseShape->UseVariant(variant);
 
-        m_FillModifier.Apply(*program);
-        m_EdgeModifier.Apply(*program);
+        m_FillModifier.Apply(program);
+        m_EdgeModifier.Apply(program);
 
         // 時間uniform
-        GLint timeLocation = glGetUniformLocation(program->GetId(), "u_Time");
-        if (timeLocation != -1) {
-            glUniform1f(timeLocation, m_ElapsedTime);
-        }
+        Core::GL().Uniform1f(program.GetUniformLocation("u_Time"), m_ElapsedTime);
 
         // 驗證
-        program->Validate();
+        program.Validate();
         m_BaseShape->Draw(data);
     }
 
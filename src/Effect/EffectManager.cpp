@@ -1,6 +1,8 @@
 #include "Effect/EffectManager.hpp"
+#include "Core/GPUTimer.hpp"
 #include "Util/TransformUtils.hpp"
 #include "Util/Logger.hpp"
+#include "Playfield.hpp"
 
 namespace Effect {
 
@@ -35,6 +37,7 @@ namespace Effect {
 
             // LOG_DEBUG("Retrieved effect from pool, type: {}", static_cast<int>(type));
         } else {
+            ++m_PoolMisses;
             effect = EffectFactory::GetInstance().CreateEffect(type);
             effect->GetBaseShape()->SetUserData(static_cast<int>(type));
 
@@ -46,8 +49,16 @@ namespace Effect {
     }
 
     void EffectManager::Draw() {
+        // 發光邊緣、逐像素旋轉等特效著色器的 GPU 時間都算在這裡
+        Core::GPUTimerScope timer("Effects");
+        m_CulledCount = 0;
         for (auto& effect : m_ActiveEffects) {
             if (effect->IsActive()) {
+                // 形狀可能自行旋轉，用外接圓判斷是否在畫面外
+                if (Playfield::IsOutside(effect->GetPosition(), glm::length(effect->GetSize()) / 2.0f)) {
+                    ++m_CulledCount;
+                    continue;
+                }
                 auto data = Util::ConvertToUniformBufferData(
                     Util::Transform{effect->GetPosition(), 0, {1, 1}},
                     effect->GetSize(),
@@ -1,4 +1,5 @@
 #include "Effect/Modifier/EdgeModifier.hpp"
+#include "Core/GLBackend.hpp"
 #include "Util/Logger.hpp"
 
 namespace Effect {
@@ -9,35 +10,21 @@ namespace Effect {
         }
 
         void EdgeModifier::Apply(Core::Program& program) {
-            if (m_EdgeTypeLocation == -1) {
-                m_EdgeTypeLocation = glGetUniformLocation(program.GetId(), "u_EdgeType");
-                m_EdgeWidthLocation = glGetUniformLocation(program.GetId(), "u_EdgeWidth");
-                m_EdgeColorLocation = glGetUniformLocation(program.GetId(), "u_EdgeColor");
-
-                // 檢查是否成功獲取 uniform 位置
-                if (m_EdgeTypeLocation == -1) {
-                    LOG_WARN("u_EdgeType uniform not found in program {}", program.GetId());
-                }
-                if (m_EdgeWidthLocation == -1) {
-                    LOG_WARN("u_EdgeWidth uniform not found in program {}", program.GetId());
-                }
-                if (m_EdgeColorLocation == -1) {
-                    LOG_WARN("u_EdgeColor uniform not found in program {}", program.GetId());
-                }
-            }
+            Core::GL().Uniform1i(program.GetUniformLocation("u_EdgeType"), static_cast<int>(m_EdgeType));
+            Core::GL().Uniform1f(program.GetUniformLocation("u_EdgeWidth"), m_Width);
+            Core::GL().Uniform4f(program.GetUniformLocation("u_EdgeColor"), m_EdgeColor.r, m_EdgeColor.g, m_EdgeColor.b, m_EdgeColor.a);
+        }
 
-            // 設置 uniform 值
-            if (m_EdgeTypeLocation != -1) {
-                glUniform1i(m_EdgeTypeLocation, static_cast<int>(m_EdgeType));
-            }
-            
-            if (m_EdgeWidthLocation != -1) {
-                glUniform1f(m_EdgeWidthLocation, m_Width);
-            }
-            
-            if (m_EdgeColorLocation != -1) {
-                glUniform4f(m_EdgeColorLocation, m_EdgeColor.r, m_EdgeColor.g, m_EdgeColor.b, m_EdgeColor.a);
+        Shape::Variant::Mask EdgeModifier::GetVariant() const {
+            switch (m_EdgeType) {
+                case EdgeType::DARK:
+                    return Shape::Variant::EDGE_DARK;
+                case EdgeType::GLOW:
+                    return Shape::Variant::EDGE_GLOW;
+                case EdgeType::NONE:
+                    break;
             }
+            return 0;
         }
 
     }
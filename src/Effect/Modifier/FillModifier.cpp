@@ -1,4 +1,5 @@
 #include "Effect/Modifier/FillModifier.hpp"
+#include "Core/GLBackend.hpp"
 #include "Util/Logger.hpp"
 
 namespace Effect {
@@ -9,31 +10,19 @@ namespace Effect {
         }
 
         void FillModifier::Apply(Core::Program& program) {
-            if (m_FillTypeLocation == -1) {
-                m_FillTypeLocation = glGetUniformLocation(program.GetId(), "u_FillType");
-
-                m_ThicknessLocation = glGetUniformLocation(program.GetId(), "u_Thickness");
-                if (m_ThicknessLocation == -1) {
-                    m_ThicknessLocation = glGetUniformLocation(program.GetId(), "u_FillThickness");
-                }
-
-                // 檢查是否成功獲取必要的 uniform 位置
-                if (m_FillTypeLocation == -1) {
-                    LOG_WARN("u_FillType uniform not found in program {}", program.GetId());
-                }
-                if (m_ThicknessLocation == -1) {
-                    LOG_WARN("u_Thickness/u_FillThickness uniform not found in program {}", program.GetId());
-                }
+            // 特化版本中用不到的 uniform 會被編譯器移除，位置為 -1 時 glUniform 不做事
+            GLint thicknessLocation = program.GetUniformLocation("u_Thickness");
+            if (thicknessLocation == -1) {
+                thicknessLocation = program.GetUniformLocation("u_FillThickness");
             }
 
             // 設置 uniform 值
-            if (m_FillTypeLocation != -1) {
-                glUniform1i(m_FillTypeLocation, static_cast<int>(m_FillType));
-            }
+            Core::GL().Uniform1i(program.GetUniformLocation("u_FillType"), static_cast<int>(m_FillType));
+            Core::GL().Uniform1f(thicknessLocation, m_Thickness);
+        }
 
-            if (m_ThicknessLocation != -1) {
-                glUniform1f(m_ThicknessLocation, m_Thickness);
-            }
+        Shape::Variant::Mask FillModifier::GetVariant() const {
+            return m_FillType == FillType::HOLLOW ? Shape::Variant::FILL_HOLLOW : 0;
         }
     }
 }
\ No newline at end of file
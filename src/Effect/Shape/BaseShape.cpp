@@ -1,9 +1,12 @@
 #include "Effect/Shape/BaseShape.hpp"
+#include "Core/FrameUniforms.hpp"
 #include "Util/Logger.hpp"
 
 namespace Effect {
     namespace Shape {
 
+        bool BaseShape::s_UseUberShader = false;
+
         BaseShape::BaseShape(float duration) {
             m_Duration = duration;
         }
@@ -29,5 +32,20 @@ namespace Effect {
             m_State = State::INACTIVE;
         }
 
+        Core::Program& BaseShape::UseVariant(Variant::Mask variant) {
+            m_Program = &GetVariants().Get(s_UseUberShader ? 0 : variant);
+            m_Program->Bind();
+            return *m_Program;
+        }
+
+        std::unique_ptr<Core::ProgramVariants> BaseShape::MakeVariants(const std::string& vertexPath,
+                                                                       const std::string& fragmentPath) {
+            return std::make_unique<Core::ProgramVariants>(
+                vertexPath, fragmentPath,
+                std::vector<std::string>{"SPECIALIZED", "FILL_HOLLOW", "EDGE_DARK", "EDGE_GLOW",
+                                         "ANIM_RIPPLE", "ANIM_TRAIL"},
+                [](const Core::Program& program) { Core::FrameUniforms::Attach(program); });
+        }
+
     }
 }
\ No newline at end of file
@@ -1,31 +1,22 @@
 #include "Effect/Shape/CircleShape.hpp"
+#include "Core/FrameUniforms.hpp"
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
 #include "Util/Logger.hpp"
 #include "config.hpp"
 
 namespace Effect {
     namespace Shape {
 
-        std::unique_ptr<Core::Program> CircleShape::s_Program = nullptr;
+        std::unique_ptr<Core::ProgramVariants> CircleShape::s_Variants = nullptr;
         std::unique_ptr<Core::VertexArray> CircleShape::s_VertexArray = nullptr;
 
         CircleShape::CircleShape(float radius, float duration)
             : BaseShape(duration), m_Radius(radius) {
 
-            if (s_Program == nullptr || s_VertexArray == nullptr) {
+            if (s_Variants == nullptr || s_VertexArray == nullptr) {
                 CircleShape::InitializeResources();
             }
-
-            m_MatricesBuffer = std::make_unique<Core::UniformBuffer<Core::Matrices>>(
-                *s_Program, "Matrices", 0);
-
-            s_Program->Bind();
-            m_RadiusLocation = glGetUniformLocation(s_Program->GetId(), "u_Radius");
-            m_ColorLocation = glGetUniformLocation(s_Program->GetId(), "u_Color");
-            m_TimeLocation = glGetUniformLocation(s_Program->GetId(), "u_Time");
-
-            if (m_RadiusLocation == -1 || m_ColorLocation == -1 || m_TimeLocation == -1) {
-                LOG_ERROR("Failed to get uniform locations for CircleShape instance");
-            }
         }
 
         CircleShape::~CircleShape() = default;
@@ -33,16 +24,20 @@ namespace Effect {
         void CircleShape::Draw(const Core::Matrices& data) {
             if (m_State != State::ACTIVE) return;
 
-            m_MatricesBuffer->SetData(0, data);
+            Core::FrameUniforms::Upload(data);
+
+            Core::GLState::SetBlend(true);
+            Core::GLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-            glEnable(GL_BLEND);
-            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            // Upload 可能先畫出排隊中的 sprite 而換掉程式，重新綁定
+            Core::Program& program = m_Program ? *m_Program : UseVariant(Variant::SPECIALIZED);
+            program.Bind();
 
-            glUniform1f(m_RadiusLocation, m_Radius);
+            Core::GL().Uniform1f(program.GetUniformLocation("u_Radius"), m_Radius);
             // 設置顏色
-            glUniform4f(m_ColorLocation, m_Color.r, m_Color.g, m_Color.b, m_Color.a);
+            Core::GL().Uniform4f(program.GetUniformLocation("u_Color"), m_Color.r, m_Color.g, m_Color.b, m_Color.a);
             // 設置時間
-            glUniform1f(m_TimeLocation, m_ElapsedTime);
+            Core::GL().Uniform1f(program.GetUniformLocation("u_Time"), m_ElapsedTime);
 
             // Draw
             s_VertexArray->Bind();
@@ -50,14 +45,9 @@ namespace Effect {
         }
 
         void CircleShape::InitializeResources() {
-            try {
-                s_Program = std::make_unique<Core::Program>(
-                    GA_RESOURCE_DIR "/shaders/Circle.vert",
-                    GA_RESOURCE_DIR "/shaders/Circle.frag");
-                LOG_INFO("Circle shape shaders loaded successfully");
-            } catch (const std::exception& e) {
-                LOG_ERROR("Failed to load circle shape shaders: {}", e.what());
-            }
+            // 各 variant 在第一次使用時才編譯
+            s_Variants = MakeVariants(GA_RESOURCE_DIR "/shaders/Circle.vert",
+                                      GA_RESOURCE_DIR "/shaders/Circle.frag");
 
             s_VertexArray = std::make_unique<Core::VertexArray>();
 
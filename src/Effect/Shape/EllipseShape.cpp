@@ -1,31 +1,22 @@
 #include "Effect/Shape/EllipseShape.hpp"
+#include "Core/FrameUniforms.hpp"
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
 #include "Util/Logger.hpp"
 #include "config.hpp"
 
 namespace Effect {
     namespace Shape {
 
-        std::unique_ptr<Core::Program> EllipseShape::s_Program = nullptr;
+        std::unique_ptr<Core::ProgramVariants> EllipseShape::s_Variants = nullptr;
         std::unique_ptr<Core::VertexArray> EllipseShape::s_VertexArray = nullptr;
 
         EllipseShape::EllipseShape(const glm::vec2& radii, float duration)
             : BaseShape(duration), m_Radii(radii) {
 
-            if (s_Program == nullptr || s_VertexArray == nullptr) {
+            if (s_Variants == nullptr || s_VertexArray == nullptr) {
                 EllipseShape::InitializeResources();
             }
-
-            m_MatricesBuffer = std::make_unique<Core::UniformBuffer<Core::Matrices>>(
-                *s_Program, "Matrices", 0);
-
-            s_Program->Bind();
-            m_RadiiLocation = glGetUniformLocation(s_Program->GetId(), "u_Radii");
-            m_ColorLocation = glGetUniformLocation(s_Program->GetId(), "u_Color");
-            m_TimeLocation = glGetUniformLocation(s_Program->GetId(), "u_Time");
-
-            if (m_RadiiLocation == -1 || m_ColorLocation == -1 || m_TimeLocation == -1) {
-                LOG_ERROR("Failed to get uniform locations for EllipseShape instance");
-            }
         }
 
         EllipseShape::~EllipseShape() = default;
@@ -33,17 +24,21 @@ namespace Effect {
         void EllipseShape::Draw(const Core::Matrices& data) {
             if (m_State != State::ACTIVE) return;
 
-            m_MatricesBuffer->SetData(0, data);
+            Core::FrameUniforms::Upload(data);
 
             // Enable blending
-            glEnable(GL_BLEND);
-            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            Core::GLState::SetBlend(true);
+            Core::GLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+            // Upload 可能先畫出排隊中的 sprite 而換掉程式，重新綁定
+            Core::Program& program = m_Program ? *m_Program : UseVariant(Variant::SPECIALIZED);
+            program.Bind();
 
-            glUniform2f(m_RadiiLocation, m_Radii.x, m_Radii.y);
+            Core::GL().Uniform2f(program.GetUniformLocation("u_Radii"), m_Radii.x, m_Radii.y);
             // 設置顏色
-            glUniform4f(m_ColorLocation, m_Color.r, m_Color.g, m_Color.b, m_Color.a);
+            Core::GL().Uniform4f(program.GetUniformLocation("u_Color"), m_Color.r, m_Color.g, m_Color.b, m_Color.a);
             // 設置時間
-            glUniform1f(m_TimeLocation, m_ElapsedTime);
+            Core::GL().Uniform1f(program.GetUniformLocation("u_Time"), m_ElapsedTime);
 
             // Draw
             s_VertexArray->Bind();
@@ -51,14 +46,9 @@ namespace Effect {
         }
 
         void EllipseShape::InitializeResources() {
-            try {
-                s_Program = std::make_unique<Core::Program>(
-                    GA_RESOURCE_DIR "/shaders/Ellipse.vert",
-                    GA_RESOURCE_DIR "/shaders/Ellipse.frag");
-                LOG_INFO("Ellipse shape shaders loaded successfully");
-            } catch (const std::exception& e) {
-                LOG_ERROR("Failed to load ellipse shape shaders: {}", e.what());
-            }
+            // 各 variant 在第一次使用時才編譯
+            s_Variants = MakeVariants(GA_RESOURCE_DIR "/shaders/Ellipse.vert",
+                                      GA_RESOURCE_DIR "/shaders/Ellipse.frag");
 
             // Initialize vertex array
             s_VertexArray = std::make_unique<Core::VertexArray>();
@@ -3,28 +3,16 @@
 #include "App.hpp"
 
 // 構造函數，初始化敵人的生命值與繪製屬性
-Enemy::Enemy(std::string name, const float health, const std::vector<std::string>& ImageSet)
-    : Character(ImageSet), m_Name(std::move(name)), m_Health(health), m_MaxHealth(health),
-      m_ColorLocation(-1), m_WidthLocation(-1) {
+Enemy::Enemy(std::string name, const float health, const Util::AssetRange ImageSet)
+    : Character(ImageSet), m_Name(std::move(name)), m_Health(health), m_MaxHealth(health) {
 
     m_Transform.scale = {0.5f, 0.5f};
     SetZIndex(10);
     GameObject::SetVisible(false);
 
     // 将初始图片集添加到集合中
-    m_ImageSetCollection.push_back(ImageSet);
+    m_ImageSetCollection[0] = ImageSet;
     m_CurrentImageSetIndex = 0;
-
-    // 確保著色程序（Shader Program）只初始化一次
-    if (!s_Program) {
-        InitProgram();
-    }
-    // 確保頂點數據（Vertex Array）只初始化一次
-    if (!s_VertexArray) {
-        InitVertexArray();
-    }
-    // 初始化 Uniform 變數（著色器中的全域變數）
-    InitUniforms();
 }
 
 // 讓敵人受到傷害，減少生命值
@@ -74,7 +62,7 @@ void Enemy::Update() {
     if (m_ShowHealthRing) UpdateHealthRing();
     if (!m_IsMoving) return;
     // 計算移動距離
-    const float DeltaTimeMs = Util::Time::GetDeltaTimeMs();
+    const float DeltaTimeMs = static_cast<float>(Util::Time::Game().GetDeltaMs());
     const float moveDistance = m_Speed * DeltaTimeMs / 1000.0f;
     m_DistanceTraveled += moveDistance;
     // 更新位置
@@ -104,28 +92,15 @@ void Enemy::InitHealthRing() {
     // 將背景圈添加到渲染樹
     App::GetInstance().AddToRoot(m_HealthRingBackground);
 
-    // 創建點狀血條
-    m_HealthDots.clear();
-    for (int i = 0; i < m_TotalDots; i++) {
-        auto dot = std::make_shared<Util::GameObject>(
-            std::make_shared<Util::Image>(GA_RESOURCE_DIR "/Image/healthPoint.png"),
-            m_ZIndex + 1  // 確保在敵人上方
-        );
-
-        // 設置點的大小
-        dot->m_Transform.scale = glm::vec2(0.05f, 0.05f);
-        dot->SetVisible(false);  // 初始隱藏
-
-        // 計算點的位置 (圓形分布)
-        const float angle = 2.0f * M_PI * i / m_TotalDots;
-        const float x = cos(angle) * m_RingRadius;
-        const float y = sin(angle) * m_RingRadius;
-
-        dot->m_Transform.translation = glm::vec2(x, y);
+    // 創建點狀血條：所有點由同一個四邊形的著色器畫出
+    m_HealthRing = std::make_shared<HealthRing>(m_RingRadius, m_TotalDots);
+    m_HealthRingObject = std::make_shared<Util::GameObject>(
+        m_HealthRing,
+        m_ZIndex + 1  // 確保在敵人上方
+    );
+    m_HealthRingObject->SetVisible(false);  // 初始隱藏
 
-        m_HealthDots.push_back(dot);
-        App::GetInstance().AddToRoot(dot);
-    }
+    App::GetInstance().AddToRoot(m_HealthRingObject);
 }
 
 void Enemy::UpdateHealthRing() {
@@ -135,10 +110,8 @@ void Enemy::UpdateHealthRing() {
             m_HealthRingBackground->SetVisible(false);
         }
 
-        for (auto& dot : m_HealthDots) {
-            if (dot) {
-                dot->SetVisible(false);
-            }
+        if (m_HealthRingObject) {
+            m_HealthRingObject->SetVisible(false);
         }
         return;
     }
@@ -149,23 +122,11 @@ void Enemy::UpdateHealthRing() {
         m_HealthRingBackground->SetVisible(true);
     }
 
-    // 計算應該顯示的點數量
-    float healthPercent = static_cast<float>(m_Health) / static_cast<float>(m_MaxHealth);
-    int visibleDots = static_cast<int>(healthPercent * m_TotalDots);
-
-    // 更新每個點的位置和可見性
-    for (int i = 0; i < m_TotalDots; i++) {
-        if (i < static_cast<int>(m_HealthDots.size()) && m_HealthDots[i]) {
-            // 計算點的位置 (相對於敵人)
-            const float angle = 2.0f * M_PI * i / m_TotalDots;
-            const float x = cos(angle) * m_RingRadius;
-            const float y = sin(angle) * m_RingRadius;
-
-            m_HealthDots[i]->m_Transform.translation = this->GetPosition() + glm::vec2(x, y);
-
-            // 根據血量決定點的可見性
-            m_HealthDots[i]->SetVisible(i < visibleDots);
-        }
+    // 亮著的點數量交給著色器判斷，這裡只更新位置與比例
+    if (m_HealthRingObject) {
+        m_HealthRingObject->m_Transform.translation = this->GetPosition();
+        m_HealthRing->SetFill(m_Health / m_MaxHealth);
+        m_HealthRingObject->SetVisible(true);
     }
 }
 
@@ -174,19 +135,20 @@ void Enemy::Reset() {
     if (m_ShowHealthRing) UpdateHealthRing();
 }
 
-void Enemy::SwitchImageSet(const std::vector<std::string>& newImageSet) {
+void Enemy::SwitchImageSet(const Util::AssetRange newImageSet) {
     if (newImageSet.empty()) {
         LOG_ERROR("Cannot switch to empty image set for enemy: {}", m_Name);
         return;
     }
     LOG_INFO("Switching image set for enemy: {} to new set with {} images", m_Name, newImageSet.size());
 
-    SetImagePathSet(newImageSet);
+    SetImageSet(newImageSet);
     RebuildAnimation(newImageSet);
 }
 
 void Enemy::SwitchImageSetByIndex(int imageSetIndex) {
-    if (imageSetIndex < 0 || imageSetIndex >= static_cast<int>(m_ImageSetCollection.size())) {
+    const auto it = m_ImageSetCollection.find(imageSetIndex);
+    if (it == m_ImageSetCollection.end()) {
         LOG_ERROR("Invalid image set index {} for enemy: {}. Available sets: {}",
                   imageSetIndex, m_Name, m_ImageSetCollection.size());
         return;
@@ -200,17 +162,19 @@ void Enemy::SwitchImageSetByIndex(int imageSetIndex) {
     LOG_INFO("Switching enemy {} from image set {} to {}", m_Name, m_CurrentImageSetIndex, imageSetIndex);
 
     m_CurrentImageSetIndex = imageSetIndex;
-    const auto& newImageSet = m_ImageSetCollection[imageSetIndex];
+    const auto newImageSet = it->second;
 
-    SetImagePathSet(newImageSet);
+    SetImageSet(newImageSet);
 
     RebuildAnimation(newImageSet);
 }
 
-void Enemy::AddImageSetCollection(const std::vector<std::vector<std::string>>& imageSets) {
+void Enemy::AddImageSetCollection(const std::vector<Util::AssetRange>& imageSets) {
     for (const auto& imageSet : imageSets) {
         if (!imageSet.empty()) {
-            m_ImageSetCollection.push_back(imageSet);
+            // 接在目前最大的索引之後
+            const int index = m_ImageSetCollection.empty() ? 0 : m_ImageSetCollection.rbegin()->first + 1;
+            m_ImageSetCollection[index] = imageSet;
         } else {
             LOG_ERROR("Skipped empty image set for enemy: {}", m_Name);
         }
@@ -219,28 +183,24 @@ void Enemy::AddImageSetCollection(const std::vector<std::vector<std::string>>& i
              imageSets.size(), m_Name, m_ImageSetCollection.size());
 }
 
-void Enemy::SetImageSetCollection(int index, const std::vector<std::string>& imageSet) {
+void Enemy::SetImageSetCollection(int index, const Util::AssetRange imageSet) {
     if (imageSet.empty()) {
         LOG_ERROR("Cannot set empty image set at index {} for enemy: {}", index, m_Name);
         return;
     }
 
-    if (index >= static_cast<int>(m_ImageSetCollection.size())) {
-        m_ImageSetCollection.resize(index + 1);
-    }
-
     m_ImageSetCollection[index] = imageSet;
     LOG_INFO("Set image set at index {} with {} images for enemy: {}",
               index, imageSet.size(), m_Name);
 
     if (index == m_CurrentImageSetIndex) {
-        SetImagePathSet(imageSet);
+        SetImageSet(imageSet);
         RebuildAnimation(imageSet);
         LOG_INFO("Updated current animation for enemy: {}", m_Name);
     }
 }
 
-void Enemy::RebuildAnimation(const std::vector<std::string>& newImageSet) {
+void Enemy::RebuildAnimation(const Util::AssetRange newImageSet) {
     SetIdleAnimation(std::make_shared<Util::Animation>(newImageSet, true, 250, true, 0));
     m_Drawable = GetIdleAnimation();
 }
\ No newline at end of file
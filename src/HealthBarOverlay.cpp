@@ -0,0 +1,86 @@
+#include "HealthBarOverlay.hpp"
+
+#include "Core/GLState.hpp"
+#include "Core/GPUTimer.hpp"
+#include "Util/Logger.hpp"
+
+HealthBarOverlay::HealthBarOverlay() {
+    InitProgram();
+    InitVertexArray();
+}
+
+void HealthBarOverlay::Submit(const glm::vec2& anchor, const float fill, const glm::vec4& color) {
+    const float y = anchor.y - STACK_SPACING * static_cast<float>(GetCount());
+
+    m_Bars.insert(m_Bars.end(), {anchor.x, y, fill});
+    m_Colors.insert(m_Colors.end(), {color.r, color.g, color.b, color.a});
+}
+
+void HealthBarOverlay::Draw() {
+    if (m_Bars.empty()) return;
+
+    if (m_Program) {
+        Core::GPUTimerScope timer("Health bars");
+        // HUD 永遠畫在最上層，不參與深度測試
+        Core::GLState::SetDepthTest(false);
+        Core::GLState::SetBlend(true);
+        Core::GLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        m_Program->Bind();
+        m_Program->Validate();
+
+        m_VertexArray->Bind();
+        m_VertexArray->GetVertexBuffer(2).SetData(m_Bars);
+        m_VertexArray->GetVertexBuffer(3).SetData(m_Colors);
+        m_VertexArray->DrawTrianglesInstanced(static_cast<GLsizei>(GetCount()));
+
+        Core::GLState::SetDepthTest(true);
+    }
+
+    m_Bars.clear();
+    m_Colors.clear();
+}
+
+void HealthBarOverlay::InitProgram() {
+    try {
+        m_Program = std::make_unique<Core::Program>(
+            GA_RESOURCE_DIR "/shaders/HealthBar.vert",
+            GA_RESOURCE_DIR "/shaders/HealthBar.frag"
+        );
+        LOG_INFO("Health bar shaders loaded successfully");
+    } catch (const std::exception& e) {
+        LOG_ERROR("Failed to load health bar shaders: {}", e.what());
+        m_Program.reset();
+    }
+}
+
+void HealthBarOverlay::InitVertexArray() {
+    m_VertexArray = std::make_unique<Core::VertexArray>();
+
+    // 定義血條矩形的四個頂點（確保右對齊縮放）
+    float Width = 1.8f, halfHeight = 0.01f;
+    m_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(std::vector<float>{
+        -Width,  halfHeight,  // 左上
+        -Width, -halfHeight,  // 左下
+         0.0, -halfHeight,  // 右下
+         0.0,  halfHeight   // 右上
+    }, 2));
+
+    // UV 坐標對應頂點
+    m_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(std::vector<float>{
+        0.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f,
+        1.0f, 0.0f
+    }, 2));
+
+    // 每條血條一筆的屬性，內容在 Draw() 時填入
+    m_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(std::vector<float>{}, 3), 1);
+    m_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(std::vector<float>{}, 4), 1);
+
+    // 定義繪製順序（索引緩衝）
+    m_VertexArray->SetIndexBuffer(std::make_unique<Core::IndexBuffer>(std::vector<unsigned int>{
+        0, 1, 2,  // 第一個三角形
+        0, 2, 3   // 第二個三角形
+    }));
+}
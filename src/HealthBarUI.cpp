@@ -18,23 +18,32 @@ HealthBarUI::HealthBarUI(const std::shared_ptr<Character>& character)
         m_HealthBars[i]->SetZIndex(80);
         m_HealthBars[i]->SetVisible(false);
     }
+
+    m_Connections.push_back(m_Character->VisibilityProperty().Subscribe([this](bool) { m_VisibilityDirty = true; }));
+    m_Connections.push_back(m_Character->HealthProperty().Subscribe([this](int) { m_HealthDirty = true; }));
 }
 
 void HealthBarUI::Update() {
     if (!m_Character) return;
 
-    if (m_Visible != m_Character->GetVisibility()) {
-        SetVisible(!m_Visible);
+    if (m_VisibilityDirty) {
+        if (m_Visible != m_Character->GetVisibility()) {
+            SetVisible(!m_Visible);
+        }
+        m_VisibilityDirty = false;
     }
 
-    if (m_Health != m_Character->GetHealth()) {
-        m_Health = m_Character->GetHealth();
-        m_RemainingHealthBar--;
-        if (m_RemainingHealthBar >= 0) {
-            m_HealthBars[m_RemainingHealthBar]->SetVisible(false);
-        }else {
-            LOG_ERROR("Health Bar Visibility Error");
+    if (m_HealthDirty) {
+        if (m_Health != m_Character->GetHealth()) {
+            m_Health = m_Character->GetHealth();
+            m_RemainingHealthBar--;
+            if (m_RemainingHealthBar >= 0) {
+                m_HealthBars[m_RemainingHealthBar]->SetVisible(false);
+            }else {
+                LOG_ERROR("Health Bar Visibility Error");
+            }
         }
+        m_HealthDirty = false;
     }
 }
 
@@ -42,6 +51,8 @@ void HealthBarUI::SetVisible(const bool visible) {
     if (!m_Character) return;
 
     m_Visible = visible;
+    // 外部直接設定時，下次 Update() 重新和角色同步
+    m_VisibilityDirty = true;
 
     for (int i = 0; i < MAX_HEALTH_BARS; ++i) {
         m_HealthBars[i]->SetVisible(m_Visible);
@@ -60,6 +71,8 @@ void HealthBarUI::Reset() {
     m_RemainingHealthBar = 3;
 
     m_Visible = false;
+    m_VisibilityDirty = true;
+    m_HealthDirty = true;
 }
 
 void HealthBarUI::FullHealthBar() {
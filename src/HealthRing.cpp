@@ -0,0 +1,112 @@
+#include "HealthRing.hpp"
+
+#include "Core/FrameUniforms.hpp"
+#include "Core/GLBackend.hpp"
+#include "Core/GLState.hpp"
+#include "Util/Logger.hpp"
+
+std::unique_ptr<Core::Program> HealthRing::s_Program = nullptr;
+std::unique_ptr<Core::VertexArray> HealthRing::s_VertexArray = nullptr;
+
+GLint HealthRing::s_SizeLocation = -1;
+GLint HealthRing::s_RadiusLocation = -1;
+GLint HealthRing::s_DotRadiusLocation = -1;
+GLint HealthRing::s_SegmentsLocation = -1;
+GLint HealthRing::s_LitLocation = -1;
+GLint HealthRing::s_ColorLocation = -1;
+
+HealthRing::HealthRing(const float radius, const int segments, const float dotRadius)
+    : m_Radius(radius), m_Segments(std::max(segments, 1)), m_DotRadius(dotRadius),
+      m_LitSegments(m_Segments) {
+    // 四邊形要包住整圈的點，外加一像素做反鋸齒
+    const float extent = 2.0f * (m_Radius + m_DotRadius + 1.0f);
+    m_Size = {extent, extent};
+
+    if (!s_Program) {
+        InitProgram();
+    }
+    if (!s_VertexArray) {
+        InitVertexArray();
+    }
+}
+
+void HealthRing::SetFill(const float fill) {
+    m_LitSegments = static_cast<int>(glm::clamp(fill, 0.0f, 1.0f) * m_Segments);
+}
+
+void HealthRing::Draw(const Core::Matrices& data) {
+    if (!s_Program || m_LitSegments <= 0) return;
+
+    Core::FrameUniforms::Upload(data);
+
+    Core::GLState::SetBlend(true);
+    Core::GLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    s_Program->Bind();
+    Core::GL().Uniform2f(s_SizeLocation, m_Size.x, m_Size.y);
+    Core::GL().Uniform1f(s_RadiusLocation, m_Radius);
+    Core::GL().Uniform1f(s_DotRadiusLocation, m_DotRadius);
+    Core::GL().Uniform1i(s_SegmentsLocation, m_Segments);
+    Core::GL().Uniform1i(s_LitLocation, m_LitSegments);
+    Core::GL().Uniform4f(s_ColorLocation, m_Color.r, m_Color.g, m_Color.b, m_Color.a);
+    s_Program->Validate();
+
+    s_VertexArray->Bind();
+    s_VertexArray->DrawTriangles();
+}
+
+void HealthRing::InitProgram() {
+    try {
+        // 頂點著色器和 CircleShape 共用，輸出以中心為原點的 UV
+        s_Program = std::make_unique<Core::Program>(
+            GA_RESOURCE_DIR "/shaders/Circle.vert",
+            GA_RESOURCE_DIR "/shaders/HealthRing.frag");
+        Core::FrameUniforms::Attach(*s_Program);
+        LOG_INFO("Health ring shaders loaded successfully");
+    } catch (const std::exception& e) {
+        LOG_ERROR("Failed to load health ring shaders: {}", e.what());
+        s_Program.reset();
+        return;
+    }
+
+    s_Program->Bind();
+    s_SizeLocation = Core::GL().GetUniformLocation(s_Program->GetId(), "u_Size");
+    s_RadiusLocation = Core::GL().GetUniformLocation(s_Program->GetId(), "u_Radius");
+    s_DotRadiusLocation = Core::GL().GetUniformLocation(s_Program->GetId(), "u_DotRadius");
+    s_SegmentsLocation = Core::GL().GetUniformLocation(s_Program->GetId(), "u_Segments");
+    s_LitLocation = Core::GL().GetUniformLocation(s_Program->GetId(), "u_Lit");
+    s_ColorLocation = Core::GL().GetUniformLocation(s_Program->GetId(), "u_Color");
+
+    if (s_SizeLocation == -1 || s_RadiusLocation == -1 || s_DotRadiusLocation == -1 ||
+        s_SegmentsLocation == -1 || s_LitLocation == -1 || s_ColorLocation == -1) {
+        LOG_ERROR("Failed to get uniform locations for HealthRing");
+    }
+}
+
+void HealthRing::InitVertexArray() {
+    s_VertexArray = std::make_unique<Core::VertexArray>();
+
+    s_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(
+        std::vector<float>{
+            -0.5f, 0.5f,   // 左上
+            -0.5f, -0.5f,  // 左下
+            0.5f, -0.5f,   // 右下
+            0.5f, 0.5f     // 右上
+        },
+        2));
+
+    s_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(
+        std::vector<float>{
+            0.0f, 0.0f,
+            0.0f, 1.0f,
+            1.0f, 1.0f,
+            1.0f, 0.0f
+        },
+        2));
+
+    s_VertexArray->SetIndexBuffer(std::make_unique<Core::IndexBuffer>(
+        std::vector<unsigned int>{
+            0, 1, 2,  // 第一個三角形
+            0, 2, 3   // 第二個三角形
+        }));
+}
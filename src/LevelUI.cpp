@@ -33,24 +33,35 @@ LevelUI::LevelUI(const std::shared_ptr<Character>& character)
     m_Money -> SetZIndex(83);
 
     LevelUI::SetVisible(false);
+
+    m_Connections.push_back(m_Character->VisibilityProperty().Subscribe([this](bool) { m_VisibilityDirty = true; }));
+    m_Connections.push_back(m_Character->LevelProperty().Subscribe([this](int) { m_LevelDirty = true; }));
+    m_Connections.push_back(m_Character->MoneyProperty().Subscribe([this](int) { m_MoneyDirty = true; }));
+    m_Connections.push_back(m_Character->ExperienceProperty().Subscribe([this](int) { m_ExperienceDirty = true; }));
 }
 
 void LevelUI::Update() {
     if (!m_Character) return;
 
-    if (m_Visible != m_Character->GetVisibility()) {
-        SetVisible(!m_Visible);
+    if (m_VisibilityDirty) {
+        if (m_Visible != m_Character->GetVisibility()) {
+            SetVisible(!m_Visible);
+        }
+        m_VisibilityDirty = false;
     }
 
-    if (m_CurrentLevel != m_Character->GetLevel()) {
+    if (m_LevelDirty) {
         m_CurrentLevel = m_Character->GetLevel();
         m_Level -> SetText(std::to_string(m_CurrentLevel));
+        m_LevelDirty = false;
     }
-    if (m_CurrentMoney != m_Character->GetMoney()) {
+    if (m_MoneyDirty) {
         m_CurrentMoney = m_Character->GetMoney();
         m_Money -> SetText(std::to_string(m_CurrentMoney));
+        m_MoneyDirty = false;
     }
-    if (m_CurrentExperience != m_Character->GetExperience()) {
+    if (m_ExperienceDirty) {
+        m_ExperienceDirty = false;
         m_CurrentExperience = m_Character->GetExperience();
         const float size = 0.9f * m_CurrentExperience/100;
         m_ExperienceBar -> SetScale(size,0.9);
@@ -63,6 +74,8 @@ void LevelUI::SetVisible(const bool visible) {
     if (!m_Character) return;
 
     m_Visible = visible;
+    // 外部直接設定時，下次 Update() 重新和角色同步
+    m_VisibilityDirty = true;
 
     m_BaseIcon->SetVisible(m_Visible);
     m_ExperienceBar->SetVisible(m_Visible);
@@ -5,7 +5,8 @@
 #include "Util/Time.hpp"
 #include "Util/TransformUtils.hpp"
 
-Object::Object(const std::string& ImagePath) {
+Object::Object(const std::string& ImagePath, float maxScale)
+    : m_MaxScale(maxScale) {
     SetImage(ImagePath);
     m_Transform.scale = glm::vec2(0.5f, 0.5f);
 
@@ -15,14 +16,14 @@ Object::Object(const std::string& ImagePath) {
 void Object::SetImage(const std::string& ImagePath) {
     m_ImagePath = ImagePath;
 
-    m_Drawable = std::make_shared<Util::Image>(m_ImagePath);
+    m_Drawable = std::make_shared<Util::Image>(m_ImagePath, m_MaxScale);
 }
 
 void Object::Update() {
     // 移動位置
     if (m_IsMoving) {
         // 計算移動距離
-        const float DeltaTimeMs = Util::Time::GetDeltaTimeMs();
+        const float DeltaTimeMs = static_cast<float>(Util::Time::Game().GetDeltaMs());
         m_TotalTime -= DeltaTimeMs;
         // 更新位置
         m_Transform.translation += m_MoveSpeed * DeltaTimeMs / 1000.0f;
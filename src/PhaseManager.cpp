@@ -1,6 +1,3 @@
-#include <iostream>
-#include <ostream>
-
 #include "PhaseManger.hpp"
 
 #include "Util/Logger.hpp"
@@ -27,7 +24,7 @@ void PhaseManager::NextSubPhase() {
         return;
     }
     m_SubPhase++;
-    std::cout << "\nPhaseManager::NextSubPhase" << std::endl;
+    LOG_DEBUG("PhaseManager::NextSubPhase");
 
     if (m_SubPhase > m_MaxSubPhase) {
         NextMainPhase();
@@ -61,9 +58,9 @@ void PhaseManager::NextMainPhase() {
 
     if (m_MainPhase > m_MaxMainPhase) {
         m_MainPhase = 1;
-        std::cout << "\nClear All Phase\n" << std::endl;
+        LOG_INFO("Clear All Phase");
     }
-    std::cout << "\nPhaseManager::NextMainPhase" << std::endl;
+    LOG_DEBUG("PhaseManager::NextMainPhase");
     LOG_INFO("Into--{}--{}", GetMainPhaseName(m_MainPhase), m_MainPhase);
 
     // 設置新的背景
@@ -4,8 +4,8 @@
 #include "Effect/EffectManager.hpp"
 #include "Effect/CompositeEffect.hpp"
 
-Skill::Skill(int skillId, const std::vector<std::string>& imageSet, int duration, float Cooldown)
-        : m_ImagePathSet(imageSet), m_Duration(duration), m_SkillId(skillId), m_Cooldown(Cooldown) {
+Skill::Skill(int skillId, const Util::AssetRange imageSet, int duration, float Cooldown)
+        : m_ImageSet(imageSet), m_Duration(duration), m_SkillId(skillId), m_Cooldown(Cooldown) {
 
     m_Animation = std::make_shared<Util::Animation>(imageSet, true, duration, false, 0);
 }
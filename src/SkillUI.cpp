@@ -1,9 +1,6 @@
 #include "SkillUI.hpp"
 #include "Util/Logger.hpp"
 
-#include <sstream>
-#include <iomanip>
-
 SkillUI::SkillUI(const std::shared_ptr<Character>& character)
     : m_Character(character) {
 
@@ -27,7 +24,7 @@ SkillUI::SkillUI(const std::shared_ptr<Character>& character)
 
 
     for (int i = 0; i < NUM_SKILLS; ++i) {
-        m_SkillIcons2.emplace_back( std::make_shared<Object>(IconImagePath(i+1)) );
+        m_SkillIcons2.emplace_back( std::make_shared<Object>(IconImagePath(i+1), 0.18f) );
         m_SkillIcons2[i] -> m_Transform.scale = {0.18f, 0.18f};
         m_SkillIcons2[i] -> SetZIndex(80);
 
@@ -41,46 +38,67 @@ SkillUI::SkillUI(const std::shared_ptr<Character>& character)
         m_ExclamationMark[i] -> SetPosition(glm::vec2(baseX + i * 100+5, baseY+25));
         m_ExclamationMark[i] -> SetZIndex(81);
     }
+
+    if (!m_Character) return;
+
+    // 只在角色屬性改變時標記，Update() 再依旗標重繪
+    m_Connections.push_back(m_Character->VisibilityProperty().Subscribe([this](bool) { m_VisibilityDirty = true; }));
+    m_Connections.push_back(m_Character->PositionProperty().Subscribe([this](const glm::vec2&) { m_PositionDirty = true; }));
+    m_Connections.push_back(m_Character->SkillXProperty().Subscribe([this](bool) { m_SkillXDirty = true; }));
+    for (int i = 0; i < NUM_SKILLS; ++i) {
+        m_Connections.push_back(m_Character->CooldownProperty(i + 1).Subscribe([this](int) { m_CooldownDirty = true; }));
+    }
 }
 
 void SkillUI::Update() {
     if (!m_Character) return;
 
-    if (m_Visible != m_Character->GetVisibility()) {
-        SetVisible(!m_Visible);
+    if (m_VisibilityDirty) {
+        if (m_Visible != m_Character->GetVisibility()) {
+            SetVisible(!m_Visible);
+        }
+        m_VisibilityDirty = false;
     }
 
-    for (int i = 0; i < NUM_SKILLS; ++i) {
-        int skillId = i + 1;
-        float remainingCooldown = m_Character->GetRemainingCooldown(skillId);
-
-        if (remainingCooldown > 0.5f) {
-            std::stringstream ss;
-            ss << std::fixed << std::setprecision(0) << remainingCooldown;
-            m_CooldownTexts[i]->SetText(ss.str());
-            m_CooldownTexts2[i]->SetText(ss.str());
-            // LOG_INFO("CooldownTexts: {} -- {}", i, ss.str());
-        } else {
-            m_CooldownTexts[i]->SetText(" "); // 冷卻完畢，清除文字
-            m_CooldownTexts2[i]->SetText(" "); // 冷卻完畢，清除文字
+    if (m_CooldownDirty) {
+        for (int i = 0; i < NUM_SKILLS; ++i) {
+            const int seconds = m_Character->CooldownProperty(i + 1).Get();
+
+            if (seconds > 0) {
+                m_CooldownTexts[i]->SetText(std::to_string(seconds));
+                m_CooldownTexts2[i]->SetText(std::to_string(seconds));
+            } else {
+                m_CooldownTexts[i]->SetText(" "); // 冷卻完畢，清除文字
+                m_CooldownTexts2[i]->SetText(" "); // 冷卻完畢，清除文字
+            }
         }
+        m_CooldownDirty = false;
     }
 
-    if (m_Character->IsSkillXUes()) {
-        m_ExclamationMark[0]->SetText("^");
-        m_ExclamationMark[1]->SetText("^");
-    }else {
-        m_ExclamationMark[0]->SetText(" ");
-        m_ExclamationMark[1]->SetText(" ");
+    if (m_SkillXDirty) {
+        if (m_Character->IsSkillXUes()) {
+            m_ExclamationMark[0]->SetText("^");
+            m_ExclamationMark[1]->SetText("^");
+        }else {
+            m_ExclamationMark[0]->SetText(" ");
+            m_ExclamationMark[1]->SetText(" ");
+        }
+        m_SkillXDirty = false;
     }
 
-    IconsFollow();
+    // 角色沒動就不用重新擺放 8 個跟隨物件
+    if (m_PositionDirty) {
+        IconsFollow();
+        m_PositionDirty = false;
+    }
 }
 
 void SkillUI::SetVisible(const bool visible) {
     if (!m_Character) return;
 
     m_Visible = visible;
+    // 外部直接設定時，下次 Update() 重新和角色同步
+    m_VisibilityDirty = true;
 
     for (int i = 0; i < NUM_SKILLS; ++i) {
         m_SkillIcons[i] -> SetVisible(visible);
@@ -0,0 +1,135 @@
+#include "Telemetry.hpp"
+
+#include "Attack/AttackManager.hpp"
+#include "Effect/EffectManager.hpp"
+#include "PhaseManger.hpp"
+
+#include "Util/Image.hpp"
+#include "Util/Logger.hpp"
+#include "Util/SFX.hpp"
+
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// windows.h 放最後，避免它的巨集影響前面的標頭
+#if defined(_WIN32)
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+Telemetry::Telemetry() : m_StartTime(static_cast<int64_t>(std::time(nullptr))) {}
+
+void Telemetry::FrameStats::Add(const double frameMs, const size_t attacks, const size_t effects) {
+    ++frames;
+    totalMs += frameMs;
+    maxMs = std::max(maxMs, frameMs);
+    peakAttacks = std::max(peakAttacks, attacks);
+    peakEffects = std::max(peakEffects, effects);
+    ++histogram[std::min(static_cast<size_t>(frameMs / BIN_MS), BIN_COUNT - 1)];
+}
+
+double Telemetry::FrameStats::Percentile(const double fraction) const {
+    const auto target = static_cast<uint64_t>(fraction * static_cast<double>(frames));
+    uint64_t count = 0;
+    for (size_t i = 0; i < BIN_COUNT; ++i) {
+        count += histogram[i];
+        if (count > target) return static_cast<double>(i + 1) * BIN_MS;
+    }
+    return maxMs;
+}
+
+void Telemetry::RecordFrame(const double frameMs, const int mainPhase, const int subPhase,
+                            const size_t activeAttacks, const size_t activeEffects) {
+    if (!m_SkippedFirst) {
+        m_SkippedFirst = true;
+        return;
+    }
+    m_Session.Add(frameMs, activeAttacks, activeEffects);
+    m_Phases[{mainPhase, subPhase}].Add(frameMs, activeAttacks, activeEffects);
+}
+
+std::string Telemetry::FrameStatsJson(const FrameStats& stats) {
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(2)
+         << "\"frames\":" << stats.frames
+         << ",\"seconds\":" << stats.totalMs / 1000.0
+         << ",\"frameMs\":{\"avg\":" << (stats.frames > 0 ? stats.totalMs / static_cast<double>(stats.frames) : 0.0)
+         << ",\"p50\":" << stats.Percentile(0.5)
+         << ",\"p95\":" << stats.Percentile(0.95)
+         << ",\"p99\":" << stats.Percentile(0.99)
+         << ",\"max\":" << stats.maxMs << "}"
+         << ",\"peakAttacks\":" << stats.peakAttacks
+         << ",\"peakEffects\":" << stats.peakEffects;
+    return json.str();
+}
+
+uint64_t Telemetry::GetPeakRssBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss);  // macOS 單位為位元組
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;  // Linux 單位為 KiB
+#endif
+#endif
+}
+
+std::string Telemetry::WriteReport(const std::string& directory) const {
+    const auto& textures = Util::Image::GetTextureStats();
+    const auto& images = Util::Image::GetStoreStats();
+    const auto& sounds = Util::SFX::GetStoreStats();
+
+    // 格式變動時遞增 version，比較報告前先確認版本相同
+    std::ostringstream json;
+    json << "{\"version\":1"
+         << ",\"start\":" << m_StartTime
+         << "," << FrameStatsJson(m_Session)
+         << ",\"effectPoolMisses\":" << Effect::EffectManager::GetInstance().GetPoolMissCount()
+         << ",\"assets\":{\"textureUploads\":" << textures.uploads
+         << ",\"cookedTextures\":" << textures.cooks
+         << ",\"imageDecodes\":" << images.misses
+         << ",\"soundDecodes\":" << sounds.misses << "}"
+         << ",\"peakRssBytes\":" << GetPeakRssBytes()
+         << ",\"phases\":[";
+    bool first = true;
+    for (const auto& [phase, stats] : m_Phases) {
+        json << (first ? "" : ",")
+             << "{\"main\":\"" << PhaseManager::GetMainPhaseName(phase.first) << "\""
+             << ",\"mainIndex\":" << phase.first
+             << ",\"sub\":\"" << PhaseManager::GetSubPhaseName(phase.second) << "\""
+             << ",\"subIndex\":" << phase.second
+             << "," << FrameStatsJson(stats) << "}";
+        first = false;
+    }
+    json << "]}\n";
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        LOG_WARN("Can't create telemetry directory '{}': {}", directory, error.message());
+        return "";
+    }
+    const std::string path = directory + "/session_" + std::to_string(m_StartTime) + ".json";
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << json.str();
+    if (!file) {
+        LOG_WARN("Failed to write telemetry report '{}'", path);
+        return "";
+    }
+    return path;
+}
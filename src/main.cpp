@@ -7,6 +7,11 @@ int main(int, char**) {
     App& app = App::GetInstance();
 
     while (!context->GetExit()) {
+        // 疊加層關閉時不開 ImGui 畫面，省下每幀的 NewFrame 與 ImGui pass
+        const bool debugOverlay = app.IsDebugOverlayShown();
+        if (debugOverlay) {
+            context->Setup();
+        }
         switch (app.GetCurrentState()) {
             case App::State::START:
                 app.Start();
@@ -21,7 +26,14 @@ int main(int, char**) {
                 context->SetExit(true);
                 break;
         }
+        if (debugOverlay) {
+            app.DrawDebugOverlay();
+        }
         context->Update();
     }
+
+    // 在 main 結束前關閉視窗與 logger，不留給靜態解構 (那時 spdlog 已經解構)
+    context.reset();
+    Core::Context::DestroyInstance();
     return 0;
 }